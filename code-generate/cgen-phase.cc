@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <string.h>
+#include <sstream>
 #include "seal-io.h"  //includes iostream
 #include "seal-decl.h"
 #include "seal-stmt.h"
@@ -12,6 +13,7 @@ extern char *out_filename;    // name of output assembly
 extern Program ast_root;             // root of the abstract syntax tree
 extern int omerrs;            // syntax errors
 extern int semant_errors;     // semant errors
+extern int cgen_single_pass;
 FILE *fin;       // we read the AST from standard input
 extern int seal_yyparse(void); // entry point to the AST parser
 
@@ -29,6 +31,7 @@ int main(int argc, char *argv[]) {
 	}
   curr_lineno = 1;
   handle_flags(argc,argv);
+  tree_arena.at_release(free_string_tables);
   firstfile_index = optind;
 
   if (!out_filename && optind < argc) {   // no -o option
@@ -47,7 +50,15 @@ int main(int argc, char *argv[]) {
     cerr << "syntax analyze failed. Please make sure syntax parser passed." << endl;
     exit(-1);
   }
-  ast_root->semant();
+  // with -fsingle-pass each function is coded as soon as it is checked,
+  // into a buffer that is written out once every function has passed
+  bool single_pass = cgen_single_pass;
+  std::ostringstream code;
+  if (single_pass) {
+    ast_root->cgen_single_pass(code);
+  } else {
+    ast_root->semant();
+  }
   if(semant_errors != 0) {
     cerr << "semant analyze failed. Please make sure semant parser passed." << endl;
     exit(-1);
@@ -58,10 +69,15 @@ int main(int argc, char *argv[]) {
         cerr << "Cannot open output file " << out_filename << endl;
         exit(1);
       }
-      ast_root->cgen(s);
+      if (single_pass) s << code.str();
+      else ast_root->cgen(s);
+  } else if (single_pass) {
+      cout << code.str();
   } else {
       ast_root->cgen(cout);
   }
   fclose(fin);
+  // the AST and everything semant kept go at once
+  tree_arena.release();
 }
 
@@ -8,18 +8,62 @@
 
 #include "cgen.h"
 #include "cgen_gc.h"
+#include "seal-flat.h"
 #include <vector>
+#include <climits>
+#include <sstream>
 
 using namespace std;
 
 extern void emit_string_constant(ostream& str, char *s);
 extern int cgen_debug;
+extern int cgen_optimize;
+extern int cgen_whole_program;
+extern int cgen_function_sections;
+extern int cgen_avx, cgen_fma, cgen_fp_contract;
 
 static char *CALL_REGS[] = {RDI, RSI, RDX, RCX, R8, R9};
 static char *CALL_XMM[] = {XMM0, XMM1, XMM2, XMM3};
 
-void cgen_helper(Decls decls, ostream& s);
-void code(Decls decls, ostream& s);
+// the argument registers of the -fwhole-program convention
+static const char *INTERNAL_REGS[] = {RDI, RSI, RDX, RCX, R8, R9, R12, R13, R14, R15};
+static const char *INTERNAL_XMM[] = {XMM0, XMM1, XMM2, XMM3, XMM4, XMM5, XMM6, XMM7,
+                                     XMM8, XMM9, XMM10, XMM11, XMM12, XMM13, XMM14, XMM15};
+
+// the registers a value of each type is passed and returned in
+enum { NO_REGISTER, INT_REGISTER, FLOAT_REGISTER };
+static const int register_class[TYPE_TAGS] = {
+  NO_REGISTER,      // NO_TYPE
+  NO_REGISTER,      // VOID_TYPE
+  INT_REGISTER,     // INT_TYPE
+  FLOAT_REGISTER,   // FLOAT_TYPE
+  INT_REGISTER,     // BOOL_TYPE
+  INT_REGISTER,     // STRING_TYPE
+};
+
+// the registers an operation on operands of two types works in: an
+// Int with a Float is converted and the operation done in SSE
+// registers; pairs that do not type check have no operation
+static const int operation_class[TYPE_TAGS][TYPE_TAGS] = {
+  // NO_TYPE      VOID_TYPE    INT_TYPE        FLOAT_TYPE      BOOL_TYPE     STRING_TYPE
+  {NO_REGISTER, NO_REGISTER, NO_REGISTER,    NO_REGISTER,    NO_REGISTER,  NO_REGISTER},  // NO_TYPE
+  {NO_REGISTER, NO_REGISTER, NO_REGISTER,    NO_REGISTER,    NO_REGISTER,  NO_REGISTER},  // VOID_TYPE
+  {NO_REGISTER, NO_REGISTER, INT_REGISTER,   FLOAT_REGISTER, NO_REGISTER,  NO_REGISTER},  // INT_TYPE
+  {NO_REGISTER, NO_REGISTER, FLOAT_REGISTER, FLOAT_REGISTER, NO_REGISTER,  NO_REGISTER},  // FLOAT_TYPE
+  {NO_REGISTER, NO_REGISTER, NO_REGISTER,    NO_REGISTER,    INT_REGISTER, NO_REGISTER},  // BOOL_TYPE
+  {NO_REGISTER, NO_REGISTER, NO_REGISTER,    NO_REGISTER,    NO_REGISTER,  NO_REGISTER},  // STRING_TYPE
+};
+
+static int operation_register(Expr e1, Expr e2)
+{
+  return operation_class[e1->getTag()][e2->getTag()];
+}
+
+void cgen_helper(Decls decls, const FlatTree &flat, ostream& s);
+void code(Decls decls, const FlatTree &flat, ostream& s);
+void code_global_data(const FlatTree &flat, ostream &str);
+static void code_text_start(Decls decls, ostream &str);
+static void code_call(Decl decl, ostream &str);
 
 //////////////////////////////////////////////////////////////////
 //
@@ -28,9 +72,8 @@ void code(Decls decls, ostream& s);
 //  
 //
 //////////////////////////////////////////////////////////////////
-// variable name - memory
-typedef SymbolTable<Symbol, int> variableTable;
-variableTable variabletab;
+// frame slot number - memory, for the function being coded
+std::vector<int> frame_slots;
 // function - offset
 typedef std::map<Symbol, int> functionTable;
 
@@ -39,6 +82,10 @@ int tempaddress = 0;
 int labelNum = 0;
 int continuePos = 0;
 int breakPos = 0;
+// lowest slot used so far by the function being coded
+int frame_bottom = 0;
+// rarely taken branches of the function being coded, emitted after it
+std::vector<string> cold_blocks;
 // you can add any helper functions here
 static void emit_mrmovsd(const char *base_reg,int offset, const char *dest, ostream& s)
 {
@@ -93,13 +140,67 @@ static void initialize_constants(void)
 //
 //*********************************************************
 
+//
+// -c: the flat tree must print just like the AST it was taken from
+//
+static void check_flat_tree(Program program, const FlatTree &flat)
+{
+  std::ostringstream tree, flat_tree;
+  program->dump(tree, 0);
+  flat.dump(flat_tree, flat.root(), 0);
+  if (tree.str() == flat_tree.str())
+    cout << "Flat tree matches the AST: " << flat.size() << " nodes" << endl;
+  else
+    cout << "Flat tree differs from the AST" << endl;
+}
+
 void Program_class::cgen(ostream &os) 
 {
   // spim wants comments to start with '#'
   os << "# start of generated code\n";
 
   initialize_constants();
-  cgen_helper(decls,os);
+  if (cgen_optimize) {
+    if (cgen_debug) cout << "Optimizing calls" << endl;
+    optimize_calls(decls);
+  }
+  // taken after -O has rewritten the functions, for order_calls
+  FlatTree flat(this);
+  if (cgen_debug) check_flat_tree(this, flat);
+  cgen_helper(decls,flat,os);
+
+  os << "\n# end of generated code\n";
+}
+
+//
+// -fsingle-pass: semant() and cgen() in one walk over the functions,
+// without -O. The signatures and globals are installed up front, then
+// each function is checked and, while no error has been found, coded
+// at once: checking it left its variables resolved to frame slots, so
+// resolve_variables does not run. Nothing must reach the output before
+// the last function is checked, so os is best a buffer.
+//
+void Program_class::cgen_single_pass(ostream &os)
+{
+  os << "# start of generated code\n";
+
+  install_signatures(decls);
+  initialize_constants();
+  FlatTree flat(this);
+  if (cgen_debug) check_flat_tree(this, flat);
+
+  if (cgen_debug) cout << "Coding global data" << endl;
+  code_global_data(flat, os);
+  code_text_start(decls, os);
+
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    Decl decl = decls->nth(i);
+    if (decl->isCallDecl() && check_call(decl)) {
+      if (cgen_debug) cout << "Coding " << decl->getName() << endl;
+      code_call(decl, os);
+    }
+  }
+  halt_on_semant_errors();
 
   os << "\n# end of generated code\n";
 }
@@ -325,6 +426,11 @@ static void emit_jnz(const char *dest, ostream& s)
 
 static void emit_call(const char *dest, ostream& s)
 {
+  // rsp drifts below offset in loops; realign it as the ABI requires.
+  // With -O the frame is reserved once and stays aligned.
+  if (!cgen_optimize) {
+    emit_and("$-16", RSP, s);
+  }
   s << CALL << " " << dest << endl;
 }
 
@@ -362,6 +468,329 @@ static void emit_int_to_float(const char *int_reg, const char *float_mmx, ostrea
 {
   s << CVTSI2SDQ << int_reg << COMMA << float_mmx << endl;
 }
+
+//
+// Reserve a stack slot below offset and make it tempaddress. Without
+// -O rsp is moved for every slot; with -O the frame is reserved once
+// in the prologue (see CallDecl_class::code) and slots are released
+// again once their value has been used (see code_operands).
+//
+static int new_temp(ostream &s)
+{
+  if (!cgen_optimize) {
+    emit_sub("$8", RSP, s);
+  }
+  offset -= 8;
+  frame_bottom = std::min(frame_bottom, offset);
+  tempaddress = offset;
+  return offset;
+}
+
+//
+// With -O, Int and Bool constants that fit in 32 bits are used as
+// immediate operands instead of being stored to the stack first.
+//
+static bool immediate(Expr e, char *imm)
+{
+  long long v;
+  Boolean b;
+  if (!cgen_optimize) {
+    return false;
+  }
+  if (e->is_const_bool(b)) {
+    sprintf(imm, "$%d", b ? 1 : 0);
+    return true;
+  }
+  if (e->is_const_int(v) && v >= INT_MIN && v <= INT_MAX) {
+    sprintf(imm, "$%lld", v);
+    return true;
+  }
+  return false;
+}
+
+// codes the second operand of a binary operation, unless the operation
+// is in general registers and it can be an immediate (left in imm,
+// which is empty otherwise)
+static int code_operand2(Expr e1, Expr e2, char *imm, ostream &s)
+{
+  if (operation_register(e1, e2) == INT_REGISTER && immediate(e2, imm)) {
+    return 0;
+  }
+  imm[0] = '\0';
+  e2->code(s);
+  return tempaddress;
+}
+
+// rax = 1 if the flags satisfy the condition, else 0: with -O by
+// setcc, else by a branch diamond
+static void emit_flag_value(const char *jcc, const char *setcc, ostream &s)
+{
+  if (cgen_optimize) {
+    s << setcc << AL << endl;
+    s << MOVZBQ << AL << COMMA << RAX << endl;
+    return;
+  }
+  int pos1 = labelNum ++;
+  int pos2 = labelNum ++;
+  s<<jcc<<" "<<POSITION<<pos1<<endl;
+  emit_mov("$0", RAX, s);
+  s<<JMP<<" "<<POSITION<<pos2<<endl;
+  s<<POSITION<<pos1<<":"<<endl;
+  emit_mov("$1", RAX, s);
+  s<<POSITION<<pos2<<":"<<endl;
+}
+
+
+// with -O, statements after a return, break or continue have been
+// removed, so a block containing one never falls through its end
+static bool ends_in_jump(Stmt stmt)
+{
+  return cgen_optimize && (stmt->isReturn() || stmt->isBreak() || stmt->isContinue());
+}
+
+// the second Int operand: the immediate if there is one, else reg
+// loaded from addr
+static const char *int_operand2(const char *imm, int addr, const char *reg, ostream &s)
+{
+  if (imm[0] != '\0') {
+    return imm;
+  }
+  emit_mrmov(RBP, addr, reg, s);
+  return reg;
+}
+
+//
+// With -O, the operands of a binary operation are coded heavier
+// first when neither has effects, so fewer temporaries are live at
+// once (Sethi-Ullman order, see temporaries in cgen_opt.cc), and
+// their slots are released afterwards: the caller loads them before
+// storing to its own result slot, which may reuse one of them. When
+// allowed, the second operand may be left as an immediate in imm.
+//
+static void code_operands(Expr e1, Expr e2, int &addr1, int &addr2, char *imm, bool allow_imm, ostream &s)
+{
+  int mark = offset;
+  SymbolSet none;
+  imm[0] = '\0';
+  bool use_imm = allow_imm && operation_register(e1, e2) == INT_REGISTER && immediate(e2, imm);
+  if (cgen_optimize && !use_imm && e2->temporaries() > e1->temporaries() &&
+      e1->is_invariant(none) && e2->is_invariant(none)) {
+    e2->code(s);
+    addr2 = tempaddress;
+    e1->code(s);
+    addr1 = tempaddress;
+  } else {
+    e1->code(s);
+    addr1 = tempaddress;
+    addr2 = allow_imm ? code_operand2(e1, e2, imm, s) : (e2->code(s), tempaddress);
+  }
+  if (cgen_optimize) {
+    offset = mark;
+  }
+}
+
+// the same for the operand of a unary operation
+static int code_operand(Expr e1, ostream &s)
+{
+  int mark = offset;
+  e1->code(s);
+  if (cgen_optimize) {
+    offset = mark;
+  }
+  return tempaddress;
+}
+//
+// A Float operation of e1 and e2 (either may be an Int, converted
+// first) into a new result slot. With -march AVX the VEX form takes
+// its second operand straight from the slot.
+//
+static void code_float_operation(const char *sse_op, const char *vex_op, Expr e1, Expr e2,
+                                 int addr1, int addr2, ostream &s)
+{
+  bool int1 = register_class[e1->getTag()] == INT_REGISTER;
+  bool int2 = register_class[e2->getTag()] == INT_REGISTER;
+  if (!cgen_avx) {
+    if (int1) emit_mrmov(RBP, addr1, RBX, s); else emit_mrmovsd(RBP, addr1, XMM4, s);
+    if (int2) emit_mrmov(RBP, addr2, RBX, s); else emit_mrmovsd(RBP, addr2, XMM5, s);
+    if (int1) emit_int_to_float(RBX, XMM4, s);
+    if (int2) emit_int_to_float(RBX, XMM5, s);
+    s << sse_op << XMM5 << COMMA << XMM4 << endl;
+    emit_rmmovsd(XMM4, offset, RBP, s);
+    return;
+  }
+
+  if (int1) {
+    emit_mrmov(RBP, addr1, RBX, s);
+    s << VCVTSI2SDQ << RBX << COMMA << XMM4 << COMMA << XMM4 << endl;
+  } else {
+    s << VMOVSD << addr1 << "(" << RBP << ")" << COMMA << XMM4 << endl;
+  }
+  if (int2) {
+    emit_mrmov(RBP, addr2, RBX, s);
+    s << VCVTSI2SDQ << RBX << COMMA << XMM5 << COMMA << XMM5 << endl;
+    s << vex_op << XMM5 << COMMA << XMM4 << COMMA << XMM4 << endl;
+  } else {
+    s << vex_op << addr2 << "(" << RBP << ")" << COMMA << XMM4 << COMMA << XMM4 << endl;
+  }
+  s << VMOVSD << XMM4 << COMMA << offset << "(" << RBP << ")" << endl;
+}
+
+//
+// With FMA and -ffp-contract, a Float a * b + c, a * b - c or
+// c - a * b in one instruction with a single rounding. The three
+// operands are coded in source order.
+//
+static bool code_fused(Expr e1, Expr e2, bool subtract, int line, ostream &s)
+{
+  Expr a, b, c;
+  const char *fma_op;
+  if (!cgen_fma || !cgen_fp_contract || e1->getTag() != FLOAT_TYPE || e2->getTag() != FLOAT_TYPE) {
+    return false;
+  }
+  bool product_first = e1->is_product(a, b);
+  if (product_first) {
+    c = e2;
+    fma_op = subtract ? VFMSUB231SD : VFMADD231SD;
+  } else if (e2->is_product(a, b)) {
+    c = e1;
+    fma_op = subtract ? VFNMADD231SD : VFMADD231SD;
+  } else {
+    return false;
+  }
+  if (a->getTag() != FLOAT_TYPE || b->getTag() != FLOAT_TYPE) {
+    return false;
+  }
+  if (cgen_debug) cout << "Fusing multiply-add at line " << line << endl;
+
+  int mark = offset;
+  int addr_a, addr_b, addr_c;
+  if (!product_first) {
+    c->code(s);
+    addr_c = tempaddress;
+  }
+  a->code(s);
+  addr_a = tempaddress;
+  b->code(s);
+  addr_b = tempaddress;
+  if (product_first) {
+    c->code(s);
+    addr_c = tempaddress;
+  }
+  if (cgen_optimize) {
+    offset = mark;
+  }
+
+  new_temp(s);
+  s << VMOVSD << addr_c << "(" << RBP << ")" << COMMA << XMM4 << endl;
+  s << VMOVSD << addr_a << "(" << RBP << ")" << COMMA << XMM5 << endl;
+  s << fma_op << addr_b << "(" << RBP << ")" << COMMA << XMM5 << COMMA << XMM4 << endl;
+  s << VMOVSD << XMM4 << COMMA << offset << "(" << RBP << ")" << endl;
+  return true;
+}
+
+// Divide or Mod of operands known to lie in [0, 2^32) (see
+// cgen_opt.cc): a shift or mask by a power-of-two divisor, else the
+// unsigned 32-bit divide, several times cheaper than idivq. Returns
+// the register left holding the result.
+static const char *code_unsigned_division(Expr e2, int addr1, int addr2, const char *imm,
+                                          bool remainder, ostream &s)
+{
+  long long d;
+  emit_mrmov(RBP, addr1, RAX, s);
+  if (e2->is_const_int(d) && d > 0 && (d & (d - 1)) == 0) {
+    char buf[32];
+    if (remainder) {
+      sprintf(buf, "$%lld", d - 1);
+      emit_and(buf, RAX, s);
+    } else {
+      int k = 0;
+      while ((1LL << k) < d) k++;
+      sprintf(buf, "$%d", k);
+      s << SHR << buf << COMMA << RAX << endl;
+    }
+    return RAX;
+  }
+  s << XORL << EDX << COMMA << EDX << endl;
+  if (imm[0] != '\0') {
+    s << MOVL << imm << COMMA << EBX << endl;
+  } else {
+    emit_mrmov(RBP, addr2, RBX, s);
+  }
+  s << DIVL << EBX << endl;
+  return remainder ? RDX : RAX;
+}
+//
+// Comparisons set the flags with cmpq (Int and Bool operands) or
+// ucomisd (Float, or Int converted to Float), then either
+// materialize the result or branch on it directly.
+//
+enum { CMP_LT, CMP_LE, CMP_EQ, CMP_NE, CMP_GE, CMP_GT };
+
+// the jump taken when the comparison holds, the one taken when it
+// does not, and the setcc materializing it
+struct CondCodes {
+  const char *jcc;
+  const char *jncc;
+  const char *setcc;
+};
+
+static const CondCodes INT_CONDITIONS[] = {
+  {JL, JGE, SETL}, {JLE, JG, SETLE}, {JE, JNE, SETE},
+  {JNE, JE, SETNE}, {JGE, JL, SETGE}, {JG, JLE, SETG}
+};
+
+static const CondCodes FLOAT_CONDITIONS[] = {
+  {JB, JAE, SETB}, {JBE, JA, SETBE}, {JE, JNE, SETE},
+  {JNE, JE, SETNE}, {JAE, JB, SETAE}, {JA, JBE, SETA}
+};
+
+static void load_float(Expr e, int addr, const char *xmm, ostream &s)
+{
+  if (register_class[e->getTag()] == FLOAT_REGISTER) {
+    emit_mrmovsd(RBP, addr, xmm, s);
+  } else {
+    emit_mrmov(RBP, addr, RAX, s);
+    emit_int_to_float(RAX, xmm, s);
+  }
+}
+
+// codes both operands and compares them, after reserving the result
+// slot if one is needed (subq would clobber the flags)
+static const CondCodes *code_compare(Expr e1, Expr e2, int op, bool result_slot, ostream &s)
+{
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, true, s);
+  if (result_slot) {
+    new_temp(s);
+  }
+
+  if (operation_register(e1, e2) == INT_REGISTER) {
+    emit_mrmov(RBP, addr1, RAX, s);
+    emit_cmp(int_operand2(imm, addr2, RDX, s), RAX, s);
+    return &INT_CONDITIONS[op];
+  }
+  load_float(e1, addr1, XMM0, s);
+  load_float(e2, addr2, XMM1, s);
+  emit_ucompisd(XMM1, XMM0, s);
+  return &FLOAT_CONDITIONS[op];
+}
+
+static void code_comparison(Expr e1, Expr e2, int op, ostream &s)
+{
+  const CondCodes *cc = code_compare(e1, e2, op, true, s);
+  emit_flag_value(cc->jcc, cc->setcc, s);
+  emit_rmmov(RAX, offset, RBP, s);
+}
+
+// with -O, a comparison used as a condition jumps on the flags it
+// sets instead of materializing a Bool to test
+static void branch_comparison(Expr e1, Expr e2, int op, int pos, bool jump_if, ostream &s)
+{
+  const CondCodes *cc = code_compare(e1, e2, op, false, s);
+  s<<(jump_if ? cc->jcc : cc->jncc)<<" "<<POSITION<<pos<<endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // coding strings, ints, and booleans
@@ -399,8 +828,8 @@ void StringEntry::code_def(ostream& s)
 //
 void StrTable::code_string_table(ostream& s)
 {  
-  for (List<StringEntry> *l = tbl; l; l = l->tl())
-    l->hd()->code_def(s);
+  for (reverse_iterator e = rbegin(); e != rend(); ++e)
+    (*e)->code_def(s);
 }
 
 // the following 2 functions are useless, please DO NOT care about them
@@ -448,38 +877,187 @@ static void emit_global_bool(Symbol name, ostream& s) {
   BOOLTAG << 0 << endl;
 }
 
-void code_global_data(Decls decls, ostream &str) {
+void code_global_data(const FlatTree &flat, ostream &str) {
   int count = 0;
-  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
-    if (!decls->nth(i)->isCallDecl()) {
+  for (NodeId decl : flat.children_of(flat.root())) {
+    if (flat.kind(decl) == VARIABLE_DECL_NODE) {
       count ++;
       if (count == 1) str<<DATA<<endl;
-      Symbol name = decls->nth(i)->getName();
-      Symbol type = decls->nth(i)->getType();
-      if (type == Int) {
-        emit_global_int(name, str);
-      } else if (type == Bool) {
-        emit_global_bool(name, str);
-      } else if (type == Float) {
-        emit_global_float(name, str);
+      NodeId variable = flat.child(decl, 0);
+      Symbol name = flat.symbol(variable);
+      switch (flat.tag(variable)) {
+      case INT_TYPE:   emit_global_int(name, str); break;
+      case BOOL_TYPE:  emit_global_bool(name, str); break;
+      case FLOAT_TYPE: emit_global_float(name, str); break;
+      default:         break;
+      }
+    }
+  }
+}
+
+//
+// With -fwhole-program nothing but main is called from outside, so
+// every other function becomes a local symbol with a convention of
+// its own: up to ten Int and sixteen Float arguments in registers,
+// the rest pushed on the stack, parameters the body never reads not
+// passed at all, and no registers saved (callers keep nothing in
+// registers across a call; main saves what libc expects).
+//
+struct ArgumentPlace {
+  bool dead;            // never read by the callee, not passed
+  const char *reg;      // the register it is passed in, or
+  int stack;            // its offset above the callee's rbp
+};
+static std::map<Symbol, std::vector<ArgumentPlace> > internal_calls;
+
+// whether the function being coded uses the convention above
+static bool internal_function;
+
+void CallDecl_class::plan_arguments() {
+  if (!cgen_whole_program || name == Main) {
+    return;
+  }
+  SymbolSet used;
+  body->collect_uses(used);
+
+  std::vector<ArgumentPlace> places;
+  int int_num = 0, float_num = 0, stack_num = 0;
+  for (int i=paras->first(); paras->more(i); i=paras->next(i)) {
+    ArgumentPlace place = { used.find(paras->nth(i)->getName()) == used.end(), NULL, 0 };
+    if (!place.dead) {
+      if (paras->nth(i)->getType() == Float && float_num < 16) {
+        place.reg = INTERNAL_XMM[float_num ++];
+      } else if (paras->nth(i)->getType() != Float && int_num < 10) {
+        place.reg = INTERNAL_REGS[int_num ++];
+      } else {
+        place.stack = 16 + 8 * stack_num ++;
+      }
+    }
+    places.push_back(place);
+  }
+  internal_calls[name] = places;
+}
+
+static bool identifier_char(char c)
+{
+  return isalnum((unsigned char)c) || c == '_' || c == '$' || c == '.';
+}
+
+//
+// A function's code with what only differs between otherwise identical
+// functions made uniform: its .globl line dropped, its own name (in
+// its label, .type, .size, recursive calls and the name of its
+// .text.unlikely.<name> section) replaced by "@", and the .POS labels
+// numbered from 0 in order of appearance.
+//
+static string canonical_code(const string &text, Symbol name)
+{
+  std::map<string, int> labels;
+  string result;
+  std::istringstream lines(text);
+  string line;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, strlen(GLOBAL), GLOBAL) == 0) {
+      continue;
+    }
+    for (size_t i = 0; i < line.size(); ) {
+      size_t j = i;
+      while (j < line.size() && identifier_char(line[j])) j++;
+      if (j == i) {
+        result += line[i++];
+        continue;
       }
+      string word = line.substr(i, j - i);
+      size_t n = name->get_len();
+      if (word == name->get_string()) {
+        word = "@";
+      } else if (word.compare(0, 6, ".text.") == 0 && word.size() > n &&
+                 word.compare(word.size() - n, n, name->get_string()) == 0 &&
+                 word[word.size() - n - 1] == '.') {
+        word.replace(word.size() - n, n, "@");
+      } else if (word.compare(0, strlen(POSITION), POSITION) == 0) {
+        std::map<string, int>::iterator it = labels.insert(std::make_pair(word, (int)labels.size())).first;
+        std::ostringstream os;
+        os << POSITION << it->second;
+        word = os.str();
+      }
+      result += word;
+      i = j;
     }
+    result += '\n';
   }
+  return result;
 }
 
-void code_calls(Decls decls, ostream &str) {
+// what comes before the functions' code: the argument plans, the
+// string constants and the start of .text
+static void code_text_start(Decls decls, ostream &str) {
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    decls->nth(i)->plan_arguments();
+  }
+
   str<<SECTION<<RODATA<<endl;
   stringtable.code_string_table(str);
   str<<TEXT<<endl;
-  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
-    if (decls->nth(i)->isCallDecl()) {
-      if (decls->nth(i)->getName() == Main) {
-        offset = tempaddress = 0;
-      } else {
-        offset = tempaddress = -56;
+}
+
+// a function's code without -O, in the order of the source
+static void code_call(Decl decl, ostream &str) {
+  // main's slots overlap its saved registers; with -O the frame
+  // is laid out below them like any other function's
+  if (decl->getName() == Main) {
+    offset = tempaddress = 0;
+  } else {
+    offset = tempaddress = -56;
+  }
+  decl->code(str);
+}
+
+void code_calls(Decls decls, const FlatTree &flat, ostream &str) {
+  code_text_start(decls, str);
+
+  if (!cgen_optimize) {
+    for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+      if (decls->nth(i)->isCallDecl()) {
+        code_call(decls->nth(i), str);
+      }
+    }
+    return;
+  }
+
+  // with -O, functions are emitted callers before callees (see
+  // order_calls), and a function whose code is the same as an earlier
+  // one's but for names and label numbers is made an alias of it
+  std::vector<Decl> order;
+  std::map<Symbol, int> heat;
+  order_calls(decls, flat, order, heat);
+
+  std::map<string, Symbol> bodies;
+  for (size_t i = 0; i < order.size(); i++) {
+    Symbol name = order[i]->getName();
+    offset = tempaddress = -56;
+    std::ostringstream code;
+    order[i]->code(code);
+    string text = schedule_code(code.str(), name);
+    string key = canonical_code(text, name);
+    std::map<string, Symbol>::iterator same = bodies.find(key);
+    if (same == bodies.end() || name == Main) {
+      bodies.insert(std::make_pair(key, name));
+      if (cgen_function_sections) {
+        const char *prefix = heat[name] == HOT_FUNCTION ? ".text.hot." :
+                             heat[name] == UNLIKELY_FUNCTION ? ".text.unlikely." : ".text.";
+        str << SECTION << prefix << name << ",\"ax\",@progbits" << endl;
       }
-      decls->nth(i)->code(str);
+      str << text;
+      continue;
     }
+
+    if (cgen_debug) cout << "Folding " << name << " into " << same->second << endl;
+    if (internal_calls.find(name) == internal_calls.end()) {
+      str << GLOBAL << name << endl;
+    }
+    str << SYMBOL_TYPE << name << COMMA << FUNCTION << endl;
+    str << SET << name << COMMA << same->second << endl;
   }
 }
 
@@ -499,22 +1077,120 @@ void code_calls(Decls decls, ostream &str) {
 //
 //********************************************************
 
-void cgen_helper(Decls decls, ostream& s)
+void cgen_helper(Decls decls, const FlatTree &flat, ostream& s)
 {
 
-  code(decls, s);
+  code(decls, flat, s);
 }
 
 
-void code(Decls decls, ostream& s)
+void code(Decls decls, const FlatTree &flat, ostream& s)
 {
+  if (cgen_debug) cout << "Resolving variables" << endl;
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    decls->nth(i)->resolve_variables();
+  }
+
   if (cgen_debug) cout << "Coding global data" << endl;
-  code_global_data(decls, s);
+  code_global_data(flat, s);
 
   if (cgen_debug) cout << "Coding calls" << endl;
-  code_calls(decls, s);
+  code_calls(decls, flat, s);
+}
+
+//
+// resolve_variables: number every parameter and local of a function
+// with a slot of its frame, and point each variable reference at the
+// slot of the declaration it names, or at GLOBAL_SLOT. Runs once after
+// the AST optimizations, so that coding a reference is an index into
+// frame_slots rather than a symbol table lookup.
+//
+void CallDecl_class::resolve_variables()
+{
+  FrameLayout frame;
+  frame.scopes.enterscope();
+  for (int i=paras->first(); paras->more(i); i=paras->next(i)) {
+    frame.declare(paras->nth(i)->getName());
+  }
+  body->resolve_variables(frame);
+  frame.scopes.exitscope();
+  slot_count = frame.slots.size();
 }
 
+void StmtBlock_class::resolve_variables(FrameLayout &frame)
+{
+  frame.scopes.enterscope();
+  first_slot = frame.slots.size();
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    frame.declare(vars->nth(i)->getName());
+  }
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    stmts->nth(i)->resolve_variables(frame);
+  }
+  frame.scopes.exitscope();
+}
+
+void IfStmt_class::resolve_variables(FrameLayout &frame)
+{
+  condition->resolve_variables(frame);
+  thenexpr->resolve_variables(frame);
+  elseexpr->resolve_variables(frame);
+}
+
+void WhileStmt_class::resolve_variables(FrameLayout &frame)
+{
+  condition->resolve_variables(frame);
+  body->resolve_variables(frame);
+}
+
+void ForStmt_class::resolve_variables(FrameLayout &frame)
+{
+  initexpr->resolve_variables(frame);
+  condition->resolve_variables(frame);
+  loopact->resolve_variables(frame);
+  body->resolve_variables(frame);
+}
+
+void ReturnStmt_class::resolve_variables(FrameLayout &frame) { value->resolve_variables(frame); }
+void ContinueStmt_class::resolve_variables(FrameLayout &frame) {}
+void BreakStmt_class::resolve_variables(FrameLayout &frame) {}
+
+void Call_class::resolve_variables(FrameLayout &frame)
+{
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->resolve_variables(frame);
+  }
+}
+
+void Actual_class::resolve_variables(FrameLayout &frame) { expr->resolve_variables(frame); }
+
+void Assign_class::resolve_variables(FrameLayout &frame)
+{
+  value->resolve_variables(frame);
+  slot = frame.slot(lvalue);
+}
+
+void Object_class::resolve_variables(FrameLayout &frame) { slot = frame.slot(var); }
+void Add_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Minus_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Multi_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Divide_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Mod_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Neg_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); }
+void Lt_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Le_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Equ_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Neq_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Ge_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Gt_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void And_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Or_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Xor_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Not_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); }
+void Bitnot_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); }
+void Bitand_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+void Bitor_class::resolve_variables(FrameLayout &frame) { e1->resolve_variables(frame); e2->resolve_variables(frame); }
+
 //******************************************************************
 //
 //   Fill in the following methods to produce code for the
@@ -526,21 +1202,37 @@ void code(Decls decls, ostream& s)
 //*****************************************************************
 
 void CallDecl_class::code(ostream &s) {
-  variabletab.enterscope();
+  frame_slots.assign(slot_count, 0);
+  internal_function = internal_calls.find(name) != internal_calls.end();
 
-  s<<GLOBAL<<name<<endl<<
-  SYMBOL_TYPE<<name<<COMMA<<FUNCTION<<endl;
+  if (!internal_function) {
+    s<<GLOBAL<<name<<endl;
+  }
+  s<<SYMBOL_TYPE<<name<<COMMA<<FUNCTION<<endl;
 
   s<<name<<":"<<endl;
   emit_push(RBP, s);
   emit_mov(RSP, RBP, s);
-  emit_push(RBX, s);
-  emit_push(R10, s);
-  emit_push(R11, s);
-  emit_push(R12, s);
-  emit_push(R13, s);
-  emit_push(R14, s);
-  emit_push(R15, s);  
+  int saved = 0;
+  if (internal_function) {
+    offset = tempaddress = 0;
+  } else {
+    emit_push(RBX, s);
+    emit_push(R10, s);
+    emit_push(R11, s);
+    emit_push(R12, s);
+    emit_push(R13, s);
+    emit_push(R14, s);
+    emit_push(R15, s);  
+    saved = 56;
+  }
+
+  // with -O the body is coded first to learn the frame size, and
+  // the whole frame is reserved here at once
+  ostream &prologue = s;
+  std::ostringstream body_code;
+  ostream &out = cgen_optimize ? body_code : s;
+  frame_bottom = offset;
 
   // paras
   int int_num = 0;
@@ -548,109 +1240,262 @@ void CallDecl_class::code(ostream &s) {
   for (int i=paras->first(); paras->more(i); i=paras->next(i)) {
     Symbol name = paras->nth(i)->getName();
     Symbol type = paras->nth(i)->getType();
-    if (type == Int || type == Bool) {
-      emit_sub("$8", RSP, s);
-      offset -= 8;
-
-      variabletab.addid(name, new int(offset));
-      s << MOV << CALL_REGS[int_num ++] << COMMA << offset << '(' << RBP << ')'<<endl;
+    if (internal_function) {
+      // dead parameters still get a slot, they may be assigned to
+      ArgumentPlace place = internal_calls[this->name][i];
+      if (!place.dead && place.reg == NULL) {
+        frame_slots[i] = place.stack;
+        continue;
+      }
+      frame_slots[i] = new_temp(out);
+      if (place.reg != NULL) {
+        out << (type == Float ? MOVSD : MOV) << place.reg << COMMA << offset << '(' << RBP << ')' << endl;
+      }
+    } else if (type == Int || type == Bool) {
+      frame_slots[i] = new_temp(out);
+      out << MOV << CALL_REGS[int_num ++] << COMMA << offset << '(' << RBP << ')'<<endl;
     } else if (type == Float) {
-      emit_sub("$8", RSP, s);
-      offset -= 8;
-
-      variabletab.addid(name, new int(offset));
-      s << MOV << CALL_XMM[float_num ++] << COMMA << offset << '(' << RBP << ')' <<endl;
+      frame_slots[i] = new_temp(out);
+      out << MOV << CALL_XMM[float_num ++] << COMMA << offset << '(' << RBP << ')' <<endl;
     }
   }
 
   // body
-  body->code(s);
+  body->code(out);
+
+  if (cgen_optimize) {
+    // rsp is 16-aligned below the saved registers and the slots
+    int frame = std::max(-frame_bottom + 15, saved + 8) / 16 * 16;
+    char size[32];
+    sprintf(size, "$%d", frame - saved);
+    if (frame > saved) {
+      emit_sub(size, RSP, prologue);
+    }
+    prologue << body_code.str();
+  }
 
-  s<<SIZE<<name<<", "<<".-"<<name<<endl;
-  variabletab.exitscope();
+  // cold code stays in the function, or goes to its own unlikely
+  // section with -ffunction-sections
+  if (cgen_function_sections && !cold_blocks.empty()) {
+    s<<SIZE<<name<<", "<<".-"<<name<<endl;
+    s<<SECTION<<".text.unlikely."<<name<<",\"ax\",@progbits"<<endl;
+  }
+  for (size_t i = 0; i < cold_blocks.size(); i++) {
+    s<<cold_blocks[i];
+  }
+  if (!cgen_function_sections || cold_blocks.empty()) {
+    s<<SIZE<<name<<", "<<".-"<<name<<endl;
+  }
+  cold_blocks.clear();
 }
 
 void StmtBlock_class::code(ostream &s){
+  int block_mark = offset;
   // variable decls
   for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
-    Symbol name = vars->nth(i)->getName();
-
-    offset -= 8;
-    variabletab.addid(name, new int(offset));
-    
-    emit_sub("$8", RSP, s);
+    frame_slots[first_slot + i] = new_temp(s);
   }
 
+  // with -O the temporaries of a statement are free again after it,
+  // and the block's variables after the block
+  int mark = offset;
   for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
-    stmts->nth(i)->code(s);
+    stmts->nth(i)->code_effects(s);
+    if (cgen_optimize) {
+      offset = mark;
+    }
+  }
+  if (cgen_optimize) {
+    offset = block_mark;
   }
 }
 
-void IfStmt_class::code(ostream &s) {
+//
+// With -O, an if that only picks the value of one variable,
+//
+//   if c { x = a; } else { x = b; }    or    if c { x = a; }
+//
+// with c, a and b cheap and free of effects, computes both values and
+// keeps the one taken with cmovnz instead of branching. Longer
+// conditions are left to branch, see code_branch.
+//
+static bool single_assign(StmtBlock block, Symbol &var, int &slot, Expr &value)
+{
+  Stmts stmts = block->getStmts();
+  return block->getVariableDecls()->len() == 0 && stmts->len() == 1 &&
+      stmts->nth(stmts->first())->is_assign(var, slot, value);
+}
+
+static bool cheap(Expr e)
+{
+  SymbolSet none;
+  return e->is_invariant(none) && e->size() <= 3;
+}
+
+bool IfStmt_class::code_select(ostream &s) {
+  Symbol var, else_var;
+  int slot, else_slot;
+  Expr then_value, else_value = NULL;
+  if (!cgen_optimize || !cheap(condition) || !single_assign(thenexpr, var, slot, then_value) ||
+      slot == GLOBAL_SLOT || !cheap(then_value)) {
+    return false;
+  }
+  if (elseexpr->getVariableDecls()->len() != 0 || elseexpr->getStmts()->len() != 0) {
+    if (!single_assign(elseexpr, else_var, else_slot, else_value) || else_slot != slot || !cheap(else_value)) {
+      return false;
+    }
+  }
+
+  int var_addr = frame_slots[slot];
+
   condition->code(s);
-  emit_mrmov(RBP, tempaddress, RAX, s);
-  emit_test(RAX, RAX, s);
-  int else_pos = labelNum ++;
-  int then_pos = labelNum ++;
-  s<<JZ<<" "<<POSITION<<else_pos<<endl;
-  thenexpr->code(s);
-  s<<JMP<<" "<<POSITION<<then_pos<<endl;
-  s<<POSITION<<else_pos<<":"<<endl;
-  elseexpr->code(s);
-  s<<POSITION<<then_pos<<":"<<endl;
+  int cond_addr = tempaddress;
+  then_value->code(s);
+  int then_addr = tempaddress;
+  int else_addr = var_addr;
+  if (else_value != NULL) {
+    else_value->code(s);
+    else_addr = tempaddress;
+  }
+
+  emit_mrmov(RBP, else_addr, RAX, s);
+  emit_mrmov(RBP, then_addr, RDX, s);
+  emit_mrmov(RBP, cond_addr, RCX, s);
+  emit_test(RCX, RCX, s);
+  s << CMOVNZ << RDX << COMMA << RAX << endl;
+  emit_rmmov(RAX, var_addr, RBP, s);
+  return true;
+}
+
+void IfStmt_class::code(ostream &s) {
+  if (code_select(s)) {
+    return;
+  }
+  // with -O the likelier arm falls through, and a rarely taken one is
+  // moved out of line to the end of the function
+  double p = cgen_optimize ? then_probability() : 0.5;
+  if (cgen_debug && cgen_optimize) {
+    cout << "Branch at line " << get_line_number() << ": then " << p << ", else " << 1 - p << endl;
+  }
+  bool swap = p < 0.5;
+  StmtBlock likely = swap ? elseexpr : thenexpr;
+  StmtBlock unlikely = swap ? thenexpr : elseexpr;
+  bool empty_unlikely = unlikely->getVariableDecls()->len() == 0 && unlikely->getStmts()->len() == 0;
+  int unlikely_pos = labelNum ++;
+  int end_pos = labelNum ++;
+  condition->code_branch(s, unlikely_pos, swap);
+  likely->code(s);
+
+  if (cgen_optimize && !empty_unlikely && std::min(p, 1 - p) < COLD_PROBABILITY) {
+    s<<POSITION<<end_pos<<":"<<endl;
+    std::ostringstream cold;
+    cold<<POSITION<<unlikely_pos<<":"<<endl;
+    unlikely->code(cold);
+    if (!ends_in_jump(unlikely)) {
+      cold<<JMP<<" "<<POSITION<<end_pos<<endl;
+    }
+    cold_blocks.push_back(cold.str());
+    return;
+  }
+
+  if (!ends_in_jump(likely) && !(cgen_optimize && empty_unlikely)) {
+    s<<JMP<<" "<<POSITION<<end_pos<<endl;
+  }
+  s<<POSITION<<unlikely_pos<<":"<<endl;
+  unlikely->code(s);
+  s<<POSITION<<end_pos<<":"<<endl;
+}
+
+// with -O a loop is rotated to test its condition at the bottom, so
+// the back edge is the one taken branch of an iteration
+static void note_loop(Stmt loop)
+{
+  if (cgen_debug && cgen_optimize) {
+    cout << "Loop at line " << loop->get_line_number() << ": back edge "
+         << 1 - 1.0 / LOOP_TRIPS << ", exit " << 1.0 / LOOP_TRIPS << endl;
+  }
 }
 
 void WhileStmt_class::code(ostream &s) {
   int condition_pos = labelNum ++;
   int end_pos = labelNum ++;
+  int outer_continue = continuePos, outer_break = breakPos;
   continuePos = condition_pos;
   breakPos = end_pos;
 
-  s<<POSITION<<condition_pos<<":"<<endl;
-  condition->code(s);
-  emit_mrmov(RBP, tempaddress, RAX, s);
-  emit_test(RAX, RAX, s);
-  s<<JZ<<' '<<POSITION<<end_pos<<endl;
-  body->code(s);
-  s<<JMP<<' '<<POSITION<<condition_pos<<endl;
+  if (cgen_optimize) {
+    note_loop(this);
+    int body_pos = labelNum ++;
+    s<<JMP<<' '<<POSITION<<condition_pos<<endl;
+    s<<POSITION<<body_pos<<":"<<endl;
+    body->code(s);
+    s<<POSITION<<condition_pos<<":"<<endl;
+    condition->code_branch(s, body_pos, true);
+  } else {
+    s<<POSITION<<condition_pos<<":"<<endl;
+    condition->code_branch(s, end_pos, false);
+    body->code(s);
+    s<<JMP<<' '<<POSITION<<condition_pos<<endl;
+  }
   s<<POSITION<<end_pos<<":"<<endl;
+  continuePos = outer_continue;
+  breakPos = outer_break;
 }
 
 void ForStmt_class::code(ostream &s) {
   int condition_pos = labelNum ++;
   int expr_pos = labelNum ++;
   int end_pos = labelNum ++;
+  int outer_continue = continuePos, outer_break = breakPos;
   continuePos = expr_pos;
   breakPos = end_pos;
 
-  initexpr->code(s);
-  s<<POSITION<<condition_pos<<":"<<endl;
-  condition->code(s);
-  emit_mrmov(RBP, tempaddress, RAX, s);
-  emit_test(RAX, RAX, s);
-  s<<JZ<<" "<<POSITION<<end_pos<<endl;
-  body->code(s);
-  s<<POSITION<<expr_pos<<":"<<endl;
-  loopact->code(s);
-  s<<JMP<<" "<<POSITION<<condition_pos<<endl;
+  initexpr->code_effects(s);
+  if (cgen_optimize) {
+    note_loop(this);
+    int body_pos = labelNum ++;
+    s<<JMP<<" "<<POSITION<<condition_pos<<endl;
+    s<<POSITION<<body_pos<<":"<<endl;
+    body->code(s);
+    s<<POSITION<<expr_pos<<":"<<endl;
+    loopact->code_effects(s);
+    s<<POSITION<<condition_pos<<":"<<endl;
+    condition->code_branch(s, body_pos, true);
+  } else {
+    s<<POSITION<<condition_pos<<":"<<endl;
+    condition->code_branch(s, end_pos, false);
+    body->code(s);
+    s<<POSITION<<expr_pos<<":"<<endl;
+    loopact->code_effects(s);
+    s<<JMP<<" "<<POSITION<<condition_pos<<endl;
+  }
   s<<POSITION<<end_pos<<":"<<endl;
+  continuePos = outer_continue;
+  breakPos = outer_break;
 }
 
 void ReturnStmt_class::code(ostream &s) {
-  value->code(s);
-  if (value->getType()->get_string() == Float->get_string()) {
-    s<<MOVAPS<<tempaddress<<"("<<RBP<<"), "<<XMM0<<endl;
-  } else if (value->getType()->get_string() != Void->get_string()) {
-    emit_mrmov(RBP, tempaddress, RAX, s);
+  char imm[32];
+  if (immediate(value, imm)) {
+    emit_mov(imm, RAX, s);
+  } else {
+    value->code(s);
+    if (register_class[value->getTag()] == FLOAT_REGISTER) {
+      emit_mrmovsd(RBP, tempaddress, XMM0, s);
+    } else if (register_class[value->getTag()] == INT_REGISTER) {
+      emit_mrmov(RBP, tempaddress, RAX, s);
+    }
   }
 
-  emit_pop(R15, s);
-  emit_pop(R14, s);
-  emit_pop(R13, s);
-  emit_pop(R12, s);
-  emit_pop(R11, s);
-  emit_pop(R10, s);
-  emit_pop(RBX, s);
+  if (!internal_function) {
+    emit_pop(R15, s);
+    emit_pop(R14, s);
+    emit_pop(R13, s);
+    emit_pop(R12, s);
+    emit_pop(R11, s);
+    emit_pop(R10, s);
+    emit_pop(RBX, s);
+  }
 
   s<<LEAVE<<endl
   <<RET<<endl;
@@ -664,49 +1509,145 @@ void BreakStmt_class::code(ostream &s) {
   s<<JMP<<" "<<POSITION<<breakPos<<endl;
 }
 
-void Call_class::code(ostream &s) {
+void Call_class::code(ostream &s) { code_call(s, true); }
+
+// with -O a call whose value is not used does not store it
+void Call_class::code_effects(ostream &s) { code_call(s, !cgen_optimize); }
+
+// an actual coded for the -fwhole-program convention: pushed when
+// passed on the stack, else left in direct or addr for loading
+static void push_argument(const string &direct, int addr, ostream &s)
+{
+  if (direct.empty()) {
+    s<<PUSH<<" "<<addr<<"("<<RBP<<")"<<endl;
+  } else if (direct[0] != '$') {
+    s<<PUSH<<" "<<direct<<endl;
+  } else {
+    s<<MOV<<direct<<COMMA<<RAX<<endl;
+    emit_push(RAX, s);
+  }
+}
+
+void Call_class::code_call(ostream &s, bool value_used) {
+  int mark = offset;
   int int_num = 0;
   int float_num = 0;
   int addr[actuals->len()];
   int num = 0;
 
+  std::map<Symbol, std::vector<ArgumentPlace> >::iterator internal = internal_calls.find(name);
+  std::vector<ArgumentPlace> places;
+  if (internal != internal_calls.end()) {
+    places = internal->second;
+  }
+
+  // with -O, constants and variables are loaded straight into their
+  // argument registers below; only the other actuals need temporaries.
+  // All loads come after every actual has been coded, as before.
+  std::vector<string> direct(actuals->len());
   for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
-    if (actuals->nth(i)->getType()->get_string() == Int->get_string() || actuals->nth(i)->getType()->get_string() == Bool->get_string() || actuals->nth(i)->getType()->get_string() == String->get_string()) {
-      actuals->nth(i)->code(s);
-      addr[i] = tempaddress;
+    SymbolSet none;
+    if (!places.empty() && places[i].dead) {
+      // not passed, coded only for its effects
+      if (!actuals->nth(i)->is_invariant(none)) {
+        actuals->nth(i)->code_effects(s);
+      }
+      continue;
+    }
+    bool simple = cgen_optimize && actuals->nth(i)->argument_operand(direct[i]);
+    if (register_class[actuals->nth(i)->getTag()] == INT_REGISTER) {
+      if (!simple) {
+        actuals->nth(i)->code(s);
+        addr[i] = tempaddress;
+      }
     }
 
-    if (actuals->nth(i)->getType()->get_string() == Float->get_string()) {
+    if (register_class[actuals->nth(i)->getTag()] == FLOAT_REGISTER) {
       num ++;
-      actuals->nth(i)->code(s);
-      addr[i] = tempaddress;
+      if (!simple) {
+        actuals->nth(i)->code(s);
+        addr[i] = tempaddress;
+      }
+    }
+  }
+
+  // stack arguments, last first, keeping rsp 16-aligned at the call
+  int stack_bytes = 0;
+  for (int i=(int)places.size()-1; i>=0; i--) {
+    if (!places[i].dead && places[i].reg == NULL) {
+      stack_bytes += 8;
+    }
+  }
+  if (stack_bytes % 16 != 0) {
+    emit_sub("$8", RSP, s);
+    stack_bytes += 8;
+  }
+  for (int i=(int)places.size()-1; i>=0; i--) {
+    if (!places[i].dead && places[i].reg == NULL) {
+      push_argument(direct[i], addr[i], s);
     }
   }
 
   for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
-    if (actuals->nth(i)->getType()->get_string() == Int->get_string() || actuals->nth(i)->getType()->get_string() == Bool->get_string() || actuals->nth(i)->getType()->get_string() == String->get_string()) {
-      s<<MOV<<addr[i]<<"("<<RBP<<")"<<COMMA<<CALL_REGS[int_num ++]<<endl;
-    } else if (actuals->nth(i)->getType()->get_string() == Float->get_string()) {
-      s<<MOVSD<<addr[i]<<"("<<RBP<<")"<<COMMA<<CALL_XMM[float_num ++]<<endl;
+    if (!places.empty()) {
+      const char *reg = places[i].reg;
+      if (places[i].dead || reg == NULL) {
+        continue;
+      }
+      bool is_float = actuals->nth(i)->getTag() == FLOAT_TYPE;
+      if (direct[i].empty()) {
+        s<<(is_float ? MOVSD : MOV)<<addr[i]<<"("<<RBP<<")"<<COMMA<<reg<<endl;
+      } else if (is_float && direct[i][0] == '$') {
+        s<<MOV<<direct[i]<<COMMA<<RAX<<endl;
+        s<<MOV<<RAX<<COMMA<<reg<<endl;
+      } else {
+        s<<(is_float ? MOVSD : MOV)<<direct[i]<<COMMA<<reg<<endl;
+      }
+    } else if (register_class[actuals->nth(i)->getTag()] == INT_REGISTER) {
+      if (!direct[i].empty()) {
+        s<<MOV<<direct[i]<<COMMA<<CALL_REGS[int_num ++]<<endl;
+      } else {
+        s<<MOV<<addr[i]<<"("<<RBP<<")"<<COMMA<<CALL_REGS[int_num ++]<<endl;
+      }
+    } else if (register_class[actuals->nth(i)->getTag()] == FLOAT_REGISTER) {
+      if (direct[i].empty()) {
+        s<<MOVSD<<addr[i]<<"("<<RBP<<")"<<COMMA<<CALL_XMM[float_num ++]<<endl;
+      } else if (direct[i][0] == '$') {
+        s<<MOV<<direct[i]<<COMMA<<RAX<<endl;
+        s<<MOV<<RAX<<COMMA<<CALL_XMM[float_num ++]<<endl;
+      } else {
+        s<<MOVSD<<direct[i]<<COMMA<<CALL_XMM[float_num ++]<<endl;
+      }
     }
   }
+  if (cgen_optimize) {
+    offset = mark;
+  }
 
   if (name == print) {
-    emit_sub("$8", RSP, s);
-    offset -= 8;
+    if (!cgen_optimize) {
+      emit_sub("$8", RSP, s);
+      offset -= 8;
+    }
     s<<MOVL<<"$"<<num<<COMMA<<EAX<<endl;
     emit_call("printf", s);
-  } else if(type->get_string() == Int->get_string() || type->get_string() == Bool->get_string() || type->get_string() == String->get_string()){
-    emit_call(name->get_string(), s);
-    emit_sub("$8", RSP, s);
-    offset -= 8;
-    tempaddress = offset;
+    return;
+  }
+
+  emit_call(name->get_string(), s);
+  if (stack_bytes > 0) {
+    char size[32];
+    sprintf(size, "$%d", stack_bytes);
+    emit_add(size, RSP, s);
+  }
+  if (!value_used) {
+    return;
+  }
+  if (register_class[tag] == INT_REGISTER) {
+    new_temp(s);
     emit_rmmov(RAX, offset, RBP, s);
-  } else if (type->get_string() == Float->get_string()) {
-    emit_call(name->get_string(), s);
-    emit_sub("$8", RSP, s);
-    offset -= 8;
-    tempaddress = offset;
+  } else if (register_class[tag] == FLOAT_REGISTER) {
+    new_temp(s);
     emit_rmmovsd(XMM0, offset, RBP, s);
   }
   //
@@ -725,163 +1666,161 @@ void Call_class::code(ostream &s) {
   //
 }
 
+//
+// argument_operand: the operand to load an actual from straight into
+// its argument register, when it needs no code of its own
+//
+bool Expr_class::argument_operand(string &op) { return false; }
+
+bool Actual_class::argument_operand(string &op) { return expr->argument_operand(op); }
+
+bool Object_class::argument_operand(string &op) {
+  // a global is read in order with the other actuals, which may call
+  // something that assigns it
+  if (slot == GLOBAL_SLOT) {
+    return false;
+  }
+  std::ostringstream os;
+  os << frame_slots[slot] << "(" << RBP << ")";
+  op = os.str();
+  return true;
+}
+
+bool Const_int_class::argument_operand(string &op) {
+  op = string("$") + value->get_string();
+  return true;
+}
+
+bool Const_bool_class::argument_operand(string &op) {
+  op = value ? "$1" : "$0";
+  return true;
+}
+
+bool Const_string_class::argument_operand(string &op) {
+  std::ostringstream os;
+  stringtable.lookup_string(value->get_string())->code_ref(os);
+  op = os.str();
+  return true;
+}
+
+bool Const_float_class::argument_operand(string &op) {
+  double d_value = atof(value->get_string());
+  unsigned long long hex_value = *(unsigned long long *) &d_value;
+  char hex[32];
+  sprintf(hex, "$0x%llx", hex_value);
+  op = hex;
+  return true;
+}
+
 void Actual_class::code(ostream &s) {
   expr->code(s);
 }
 
 void Assign_class::code(ostream &s) {
-  value->code(s);
-  emit_mrmov(RBP, tempaddress, RAX, s);
+  char imm[32];
+  const char *source = RAX;
+  if (immediate(value, imm)) {
+    source = imm;
+  } else {
+    value->code(s);
+    emit_mrmov(RBP, tempaddress, RAX, s);
+  }
   
-  variabletab.enterscope();
-  tempaddress = *variabletab.lookup(lvalue);
-  variabletab.exitscope();
-
-  emit_rmmov(RAX, tempaddress, RBP, s);
+  // a global keeps the assigned value in a temporary as well, the
+  // value of the assignment
+  if (slot == GLOBAL_SLOT) {
+    s << MOV << source << COMMA << lvalue << "(" << RIP << ")" << endl;
+    new_temp(s);
+  } else {
+    tempaddress = frame_slots[slot];
+  }
+  emit_rmmov(source, tempaddress, RBP, s);
 }
 
-void Add_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
+//
+// Arithmetic: the instruction of each operation in general registers,
+// and in SSE registers without and with -march AVX. Which one is used
+// is looked up in operation_class from the operand types.
+//
+enum { ARITH_ADD, ARITH_SUB, ARITH_MUL, ARITH_DIV };
+
+struct ArithCodes {
+  const char *int_op;       // NULL where it is not one instruction
+  const char *sse_op;
+  const char *vex_op;
+};
+
+static const ArithCodes ARITHMETIC[] = {
+  {ADD, ADDSD, VADDSD}, {SUB, SUBSD, VSUBSD}, {MUL, MULSD, VMULSD}, {NULL, DIVSD, VDIVSD}
+};
+
+static void code_arithmetic(int op, Expr e1, Expr e2, ostream &s)
+{
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, true, s);
+  new_temp(s);
+  if (operation_register(e1, e2) == INT_REGISTER) {
     emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmov(RBP, addr2, R10, s);
-    emit_add(R10, RBX, s);
+    const char *operand2 = int_operand2(imm, addr2, R10, s);
+    s << ARITHMETIC[op].int_op << operand2 << COMMA << RBX << endl;
     emit_rmmov(RBX, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_addsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_int_to_float(RBX, XMM4, s);
-    emit_addsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmov(RBP, addr2, RBX, s);
-    emit_int_to_float(RBX, XMM5, s);
-    emit_addsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
+  } else {
+    code_float_operation(ARITHMETIC[op].sse_op, ARITHMETIC[op].vex_op, e1, e2, addr1, addr2, s);
+  }
+}
+
+void Add_class::code(ostream &s) {
+  if (!code_fused(e1, e2, false, get_line_number(), s)) {
+    code_arithmetic(ARITH_ADD, e1, e2, s);
   }
 }
 
 void Minus_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmov(RBP, addr2, R10, s);
-    emit_sub(R10, RBX, s);
-    emit_rmmov(RBX, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_subsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_int_to_float(RBX, XMM4, s);
-    emit_subsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmov(RBP, addr2, RBX, s);
-    emit_int_to_float(RBX, XMM5, s);
-    emit_subsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
+  if (!code_fused(e1, e2, true, get_line_number(), s)) {
+    code_arithmetic(ARITH_SUB, e1, e2, s);
   }
 }
 
+bool Multi_class::is_product(Expr &a, Expr &b) {
+  a = e1;
+  b = e2;
+  return true;
+}
+
 void Multi_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmov(RBP, addr2, R10, s);
-    emit_mul(R10, RBX, s);
-    emit_rmmov(RBX, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_mulsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_int_to_float(RBX, XMM4, s);
-    emit_mulsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmov(RBP, addr2, RBX, s);
-    emit_int_to_float(RBX, XMM5, s);
-    emit_mulsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  }
+  code_arithmetic(ARITH_MUL, e1, e2, s);
 }
 
 void Divide_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, unsigned_operands, s);
+  new_temp(s);
+  if (unsigned_operands) {
+    emit_rmmov(code_unsigned_division(e2, addr1, addr2, imm, false, s), offset, RBP, s);
+  } else if (operation_register(e1, e2) == INT_REGISTER) {
     emit_mrmov(RBP, addr1, RAX, s);
     emit_cqto(s);
     emit_mrmov(RBP, addr2, RBX, s);
     emit_div(RBX, s);
     emit_rmmov(RAX, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_divsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RBX, s);
-    emit_mrmovsd(RBP, addr2, XMM5, s);
-    emit_int_to_float(RBX, XMM4, s);
-    emit_divsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM4, s);
-    emit_mrmov(RBP, addr2, RBX, s);
-    emit_int_to_float(RBX, XMM5, s);
-    emit_divsd(XMM5, XMM4, s);
-    emit_rmmovsd(XMM4, offset, RBP, s);
+  } else {
+    code_float_operation(ARITHMETIC[ARITH_DIV].sse_op, ARITHMETIC[ARITH_DIV].vex_op,
+                         e1, e2, addr1, addr2, s);
   }
 }
 
 void Mod_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
-  emit_sub("$8", RSP, s); 
-  offset -= 8;
-  tempaddress = offset;
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, unsigned_operands, s);
+  new_temp(s);
 
+  if (unsigned_operands) {
+    emit_rmmov(code_unsigned_division(e2, addr1, addr2, imm, true, s), offset, RBP, s);
+    return;
+  }
   emit_mrmov(RBP, addr1, RAX, s);
   emit_cqto(s);
   emit_mrmov(RBP, addr2, RBX, s);
@@ -890,430 +1829,123 @@ void Mod_class::code(ostream &s) {
 }
 
 void Neg_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  int addr1 = code_operand(e1, s);
+  new_temp(s);
 
-  if (e1->getType()->get_string() == Int->get_string()) {
+  if (register_class[e1->getTag()] == INT_REGISTER) {
     emit_mrmov(RBP, addr1, RAX, s);
     emit_neg(RAX, s);
     emit_rmmov(RAX, offset, RBP, s);
   } else {
-    emit_sub("$8", RSP, s);
     emit_mov("$0x8000000000000000", RAX, s);
-    emit_mrmov(RBP, offset, RDX, s);
+    emit_mrmov(RBP, addr1, RDX, s);
     emit_xor(RAX, RDX, s);
     emit_rmmov(RDX, offset, RBP, s);
   }
 }
 
-void Lt_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+void Lt_class::code(ostream &s) { code_comparison(e1, e2, CMP_LT, s); }
+void Le_class::code(ostream &s) { code_comparison(e1, e2, CMP_LE, s); }
+void Equ_class::code(ostream &s) { code_comparison(e1, e2, CMP_EQ, s); }
+void Neq_class::code(ostream &s) { code_comparison(e1, e2, CMP_NE, s); }
+void Ge_class::code(ostream &s) { code_comparison(e1, e2, CMP_GE, s); }
+void Gt_class::code(ostream &s) { code_comparison(e1, e2, CMP_GT, s); }
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP, addr1, RAX, s);
-    emit_mrmov(RBP, addr2, RDX, s);
-    emit_cmp(RDX, RAX, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JL<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1", RAX, s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM1, s);
-    emit_mrmov(RBP, addr2, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JB<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1", RAX, s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX, offset, RBP, s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JB<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX, 0, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JB<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  }
-}
-
-void Le_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+//******************************************************************
+//
+//   code_branch: code a condition as a jump to pos taken when its
+//   value is jump_if, falling through otherwise. Without -O the
+//   value is materialized and tested. With -O, comparisons jump on
+//   their flags and &&, || and ! thread their operands' jumps
+//   straight to the final targets instead of materializing each
+//   Bool in between; the right operand is then skipped when the left
+//   decides, so this is only done when it has no effects.
+//
+//*****************************************************************
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_mrmov(RBP,addr2,RDX,s);
-    emit_cmp(RDX,RAX,s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JLE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM1, s);
-    emit_mrmov(RBP, addr2, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JBE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JBE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,0,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1,s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JBE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  }
-}
-
-void Equ_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+void Expr_class::code_branch(ostream &s, int pos, bool jump_if) {
+  code(s);
+  emit_mrmov(RBP, tempaddress, RAX, s);
+  emit_test(RAX, RAX, s);
+  s<<(jump_if ? JNZ : JZ)<<" "<<POSITION<<pos<<endl;
+}
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_mrmov(RBP,addr2,RDX,s);
-    emit_cmp(RDX,RAX,s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM1, s);
-    emit_mrmov(RBP, addr2, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,0,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  }
-}
-
-void Neq_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+void Lt_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  branch_comparison(e1, e2, CMP_LT, pos, jump_if, s);
+}
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_mrmov(RBP,addr2,RDX,s);
-    emit_cmp(RDX,RAX,s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JNE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM1, s);
-    emit_mrmov(RBP, addr2, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JNE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JNE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,0,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JNE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  }
-}
-
-void Ge_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+void Le_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  branch_comparison(e1, e2, CMP_LE, pos, jump_if, s);
+}
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_mrmov(RBP,addr2,RDX,s);
-    emit_cmp(RDX,RAX,s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JGE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM1, s);
-    emit_mrmov(RBP, addr2, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JAE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JAE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,0,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JAE<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  }
-}
-
-void Gt_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+void Equ_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  branch_comparison(e1, e2, CMP_EQ, pos, jump_if, s);
+}
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
-  if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmov(RBP,addr1,RAX,s);
-    emit_mrmov(RBP,addr2,RDX,s);
-    emit_cmp(RDX,RAX,s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JG<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Int->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM1, s);
-    emit_mrmov(RBP, addr2, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JA<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0",RAX,s);
-    s<<JMP<<" "<<POSITION<<pos2<< endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX,offset,RBP,s);
-  } else if (e1->getType()->get_string() == Int->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmov(RBP, addr1, RAX, s);
-    emit_int_to_float(RAX, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JA<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX, 0, RBP, s);
-  } else if (e1->getType()->get_string() == Float->get_string() && e2->getType()->get_string() == Float->get_string()) {
-    emit_mrmovsd(RBP, addr1, XMM0, s);
-    emit_mrmovsd(RBP, addr2, XMM1, s);
-    emit_ucompisd(XMM0, XMM1, s);
-    int pos1 = labelNum ++;
-    int pos2 = labelNum ++;
-    s<<JA<<" "<<POSITION<<pos1<<endl;
-    emit_mov("$0", RAX, s);
-    s<<JMP<<" "<<POSITION<<pos2<<endl;
-    s<<POSITION<<pos1<<":"<<endl;
-    emit_mov("$1",RAX,s);
-    s<<POSITION<<pos2<<":"<<endl;
-    emit_rmmov(RAX, offset, RBP, s);
+void Neq_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  branch_comparison(e1, e2, CMP_NE, pos, jump_if, s);
+}
+
+void Ge_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  branch_comparison(e1, e2, CMP_GE, pos, jump_if, s);
+}
+
+void Gt_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  branch_comparison(e1, e2, CMP_GT, pos, jump_if, s);
+}
+
+void And_class::code_branch(ostream &s, int pos, bool jump_if) {
+  SymbolSet none;
+  if (!cgen_optimize || !e2->is_invariant(none)) { Expr_class::code_branch(s, pos, jump_if); return; }
+  if (!jump_if) {
+    e1->code_branch(s, pos, false);
+    e2->code_branch(s, pos, false);
+    return;
+  }
+  int skip_pos = labelNum ++;
+  e1->code_branch(s, skip_pos, false);
+  e2->code_branch(s, pos, true);
+  s<<POSITION<<skip_pos<<":"<<endl;
+}
+
+void Or_class::code_branch(ostream &s, int pos, bool jump_if) {
+  SymbolSet none;
+  if (!cgen_optimize || !e2->is_invariant(none)) { Expr_class::code_branch(s, pos, jump_if); return; }
+  if (jump_if) {
+    e1->code_branch(s, pos, true);
+    e2->code_branch(s, pos, true);
+    return;
+  }
+  int skip_pos = labelNum ++;
+  e1->code_branch(s, skip_pos, true);
+  e2->code_branch(s, pos, false);
+  s<<POSITION<<skip_pos<<":"<<endl;
+}
+
+void Not_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  e1->code_branch(s, pos, !jump_if);
+}
+
+void Const_bool_class::code_branch(ostream &s, int pos, bool jump_if) {
+  if (!cgen_optimize) { Expr_class::code_branch(s, pos, jump_if); return; }
+  if ((bool)value == jump_if) {
+    s<<JMP<<" "<<POSITION<<pos<<endl;
   }
 }
 
 void And_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, false, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   emit_mrmov(RBP, addr1, RAX, s);
   emit_mrmov(RBP, addr2, RDX, s);
@@ -1322,14 +1954,11 @@ void And_class::code(ostream &s) {
 }
 
 void Or_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, false, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   emit_mrmov(RBP, addr1, RAX, s);
   emit_mrmov(RBP, addr2, RDX, s);
@@ -1338,14 +1967,11 @@ void Or_class::code(ostream &s) {
 }
 
 void Xor_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, false, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   emit_mrmov(RBP, addr1, RAX, s);
   emit_mrmov(RBP, addr2, RDX, s);
@@ -1354,26 +1980,20 @@ void Xor_class::code(ostream &s) {
 }
 
 void Not_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
+  int addr1 = code_operand(e1, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   emit_mrmov(RBP, addr1, RAX, s);
-  emit_mov("$$0x0000000000000001", RDX, s);
+  emit_mov("$0x0000000000000001", RDX, s);
   emit_xor(RDX, RAX, s);
-  emit_rmmov(RAX, offset, RBX, s);
+  emit_rmmov(RAX, offset, RBP, s);
 }
 
 void Bitnot_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
+  int addr1 = code_operand(e1, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
   
   emit_mrmov(RBP, addr1, RAX, s);
   emit_not(RAX, s);
@@ -1381,14 +2001,11 @@ void Bitnot_class::code(ostream &s) {
 }
 
 void Bitand_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, false, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   emit_mrmov(RBP, addr1, RAX, s);
   emit_mrmov(RBP, addr2, RDX, s);
@@ -1397,14 +2014,11 @@ void Bitand_class::code(ostream &s) {
 }
 
 void Bitor_class::code(ostream &s) {
-  e1->code(s);
-  int addr1 = tempaddress;
-  e2->code(s);
-  int addr2 = tempaddress;
+  int addr1, addr2;
+  char imm[32];
+  code_operands(e1, e2, addr1, addr2, imm, false, s);
 
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   emit_mrmov(RBP, addr1, RAX, s);
   emit_mrmov(RBP, addr2, RDX, s);
@@ -1413,9 +2027,7 @@ void Bitor_class::code(ostream &s) {
 }
 
 void Const_int_class::code(ostream &s) {
-  emit_sub("$8",RSP,s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   s<<MOV<<"$"<<value<<COMMA<<RAX<<endl;
   
@@ -1423,9 +2035,7 @@ void Const_int_class::code(ostream &s) {
 }
 
 void Const_string_class::code(ostream &s) {
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
   s<<MOV;
   stringtable.lookup_string(value->get_string())->code_ref(s);
   s<<COMMA<<RAX<<endl;
@@ -1434,9 +2044,7 @@ void Const_string_class::code(ostream &s) {
 }
 
 void Const_float_class::code(ostream &s) {
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   double d_value = atof(value->get_string());
   unsigned long long hex_value = *(unsigned long long *) &d_value;
@@ -1451,9 +2059,7 @@ void Const_float_class::code(ostream &s) {
 }
 
 void Const_bool_class::code(ostream &s) {
-  emit_sub("$8", RSP, s);
-  offset -= 8;
-  tempaddress = offset;
+  new_temp(s);
 
   s<<MOV<<"$"<<value<<COMMA<<RAX<<endl;
 
@@ -1461,9 +2067,13 @@ void Const_bool_class::code(ostream &s) {
 }
 
 void Object_class::code(ostream &s) {
-  variabletab.enterscope();
-  tempaddress = *variabletab.lookup(var);
-  variabletab.exitscope();
+  if (slot == GLOBAL_SLOT) {
+    new_temp(s);
+    s << MOV << var << "(" << RIP << ")" << COMMA << RAX << endl;
+    emit_rmmov(RAX, tempaddress, RBP, s);
+    return;
+  }
+  tempaddress = frame_slots[slot];
 }
 
 void No_expr_class::code(ostream &s) {
@@ -5,10 +5,59 @@
 #include "seal-decl.h"
 #include "seal-stmt.h"
 #include "seal-expr.h"
+#include "seal-flat.h"
 #include "symtab.h"
 #include <map>
 #include <string>
+#include <vector>
+#include <deque>
 #include "list.h"
 
 #define TRUE 1
-#define FALSE 0
\ No newline at end of file
+#define FALSE 0
+
+// AST optimizations in cgen_opt.cc, run with -O
+void optimize_calls(Decls decls);
+
+// the steps of Program_class::semant in semant.cc, for -fsingle-pass:
+// check_call tells whether no error has been found so far
+void install_signatures(Decls decls);
+bool check_call(Decl decl);
+void halt_on_semant_errors();
+
+// the variables in scope while resolving a function, each numbered
+// with its slot in the function's frame, see resolve_variables; with
+// -fsingle-pass, the scopes semant.cc checks the function in
+struct FrameLayout {
+  SymbolTable<Symbol, int> scopes;
+  std::deque<int> slots;            // slots[i] == i, what scopes points into
+
+  int declare(Symbol name)
+  {
+    slots.push_back(slots.size());
+    scopes.addid(name, &slots.back());
+    return slots.back();
+  }
+
+  int slot(Symbol name)
+  {
+    int *n = scopes.lookup(name);
+    return n == NULL ? GLOBAL_SLOT : *n;
+  }
+};
+
+// the times a loop is assumed to run when estimating call counts and
+// branch weights
+#define LOOP_TRIPS 10
+
+// branches taken with less than this probability have their code
+// moved out of line with -O
+#define COLD_PROBABILITY 0.15
+
+// the order functions are emitted in with -O, and the section each
+// goes to with -ffunction-sections
+enum { NORMAL_FUNCTION, HOT_FUNCTION, UNLIKELY_FUNCTION };
+void order_calls(Decls decls, const FlatTree &flat, std::vector<Decl> &order, std::map<Symbol, int> &heat);
+
+// instruction scheduling of a function's code in cgen_sched.cc, with -O
+std::string schedule_code(const std::string &text, Symbol name);
@@ -0,0 +1,2198 @@
+
+//**************************************************************
+//
+// AST level optimizations, run before code generation when the
+// compiler is invoked with -O.
+//
+//**************************************************************
+
+#include "cgen.h"
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+using namespace std;
+
+extern int cgen_debug;
+extern Symbol Int, Float, Bool, print, Main;
+
+// estimated calls from which a function counts as hot
+#define HOT_CALLS 10
+
+// code-size budget (in AST nodes) a single function may grow by
+// through loop unswitching
+#define UNSWITCH_BUDGET 256
+
+// global variables, which any call may write
+static SymbolSet globals;
+
+//////////////////////////////////////////////////////////////////
+//
+//    Helper Functions
+//
+//////////////////////////////////////////////////////////////////
+
+// the variables a loop may change on some iteration
+static void loop_variant(Stmt loop, SymbolSet &variant)
+{
+  bool calls = false;
+  loop->collect_effects(variant, calls);
+  if (calls) {
+    variant.insert(globals.begin(), globals.end());
+  }
+}
+
+//
+// Clone loop into two copies, one with inner's condition replaced by
+// true and one by false, and guard them by the original condition:
+//
+//   while c { ... if g {A} else {B} ... }
+//
+// becomes
+//
+//   if g { while c { ... A ... } } else { while c { ... B ... } }
+//
+// The constant ifs left inside the copies are folded away when the
+// copies are unswitched in turn.
+//
+static Stmt unswitch_loop(Stmt loop, IfStmt inner, int &budget)
+{
+  Expr guard = inner->getCondition();
+
+  inner->setCondition(const_bool(true)->setType(Bool));
+  Stmt then_loop = loop->copy_Stmt();
+  inner->setCondition(const_bool(false)->setType(Bool));
+  Stmt else_loop = loop->copy_Stmt();
+  inner->setCondition(guard);
+  then_loop->set(loop);
+  else_loop->set(loop);
+
+  if (cgen_debug) cout << "Unswitching loop at line " << loop->get_line_number() << endl;
+
+  Stmt result = ifstmt(guard->copy_Expr(),
+      stmtBlock(nil_VariableDecls(), single_Stmts(then_loop)),
+      stmtBlock(nil_VariableDecls(), single_Stmts(else_loop)));
+  result->set(loop);
+  return result->unswitch(budget);
+}
+
+//
+// Available expressions for value numbering. An expression is
+// keyed by its operator and the keys of its operands (see
+// value_key), so two occurrences computing the same value get the
+// same key. Scopes follow the structured control flow: an entry
+// made in a block is visible in everything the block dominates and
+// dropped when the walk leaves it. Writes to a variable kill every
+// entry reading it, in all scopes.
+//
+class ValueTable {
+private:
+  struct Entry {
+    Expr first;              // first occurrence
+    Expr *slot;              // where first hangs in its parent
+    SymbolSet reads;
+    vector<Expr*> reuses;    // later occurrences
+    bool killed;
+  };
+
+  map<string, Entry*> available;
+  vector<vector<pair<string, Entry*> > > undo;
+  vector<Entry*> entries;
+
+public:
+  ValueTable() { enterscope(); }
+  ~ValueTable();
+
+  void enterscope() { undo.push_back(vector<pair<string, Entry*> >()); }
+  void exitscope();
+
+  bool reuse(Expr e, Expr *slot);
+  void define(Expr e, Expr *slot);
+  void kill(Symbol var);
+  void kill(SymbolSet &vars);
+
+  VariableDecls rewrite();
+};
+
+ValueTable::~ValueTable()
+{
+  for (size_t i = 0; i < entries.size(); i++) {
+    delete entries[i];
+  }
+}
+
+void ValueTable::exitscope()
+{
+  vector<pair<string, Entry*> > &scope = undo.back();
+  for (size_t i = scope.size(); i-- > 0; ) {
+    if (scope[i].second == NULL) {
+      available.erase(scope[i].first);
+    } else {
+      available[scope[i].first] = scope[i].second;
+    }
+  }
+  undo.pop_back();
+}
+
+// true if e computes a value already available, in which case the
+// occurrence at slot is recorded for rewriting
+bool ValueTable::reuse(Expr e, Expr *slot)
+{
+  if (slot == NULL || e->size() <= 1) {
+    return false;
+  }
+  map<string, Entry*>::iterator it = available.find(e->value_key());
+  if (it == available.end() || it->second->killed ||
+      it->second->first->getType() != e->getType()) {
+    return false;
+  }
+  it->second->reuses.push_back(slot);
+  return true;
+}
+
+void ValueTable::define(Expr e, Expr *slot)
+{
+  string key = e->value_key();
+  if (slot == NULL || e->size() <= 1 || key.empty()) {
+    return;
+  }
+
+  Entry *entry = new Entry;
+  entry->first = e;
+  entry->slot = slot;
+  entry->killed = false;
+  e->collect_uses(entry->reads);
+  entries.push_back(entry);
+
+  map<string, Entry*>::iterator it = available.find(key);
+  undo.back().push_back(make_pair(key, it == available.end() ? (Entry*)NULL : it->second));
+  available[key] = entry;
+}
+
+void ValueTable::kill(Symbol var)
+{
+  for (map<string, Entry*>::iterator it = available.begin(); it != available.end(); ++it) {
+    if (it->second->reads.find(var) != it->second->reads.end()) {
+      it->second->killed = true;
+    }
+  }
+}
+
+void ValueTable::kill(SymbolSet &vars)
+{
+  for (SymbolSet::iterator it = vars.begin(); it != vars.end(); ++it) {
+    kill(*it);
+  }
+}
+
+//
+// Save the first occurrence of every reused value in a fresh
+// temporary and read the temporary at the later ones:
+//
+//   a = (x - y) * 2; b = (x - y) + 1;
+//
+// becomes
+//
+//   a = (cse$0 = x - y) * 2; b = cse$0 + 1;
+//
+// Returns the declarations of the temporaries.
+//
+VariableDecls ValueTable::rewrite()
+{
+  VariableDecls temps = nil_VariableDecls();
+  for (size_t i = 0; i < entries.size(); i++) {
+    Entry *entry = entries[i];
+    if (entry->reuses.empty()) {
+      continue;
+    }
+
+    char name[32];
+    sprintf(name, "cse$%d", (int)i);
+    Symbol temp = idtable.add_string(name);
+    Symbol type = entry->first->getType();
+    temps = append_VariableDecls(temps, single_VariableDecls(variableDecl(variable(temp, type))));
+
+    if (cgen_debug) cout << "Reusing " << entry->first->value_key() << " at line "
+        << entry->first->get_line_number() << " " << entry->reuses.size() << " times" << endl;
+
+    Expr save = assign(temp, entry->first);
+    save->set(entry->first);
+    *entry->slot = save->setType(type);
+    for (size_t j = 0; j < entry->reuses.size(); j++) {
+      Expr load = object(temp);
+      load->set(*entry->reuses[j]);
+      *entry->reuses[j] = load->setType(type);
+    }
+  }
+  return temps;
+}
+
+//
+// A lattice value for constant propagation: UNDEF for code not
+// (yet) known to run, CONST for a single known value, VARYING
+// otherwise.
+//
+struct ConstValue {
+  enum Kind { UNDEF, CONST, VARYING } kind;
+  Symbol type;
+  long long i;      // Int and Bool
+  double f;         // Float
+
+  bool operator==(const ConstValue &v) const
+  {
+    return kind == v.kind && (kind != CONST || (type == v.type && i == v.i &&
+        (f == v.f || (std::isnan(f) && std::isnan(v.f)))));
+  }
+  bool operator!=(const ConstValue &v) const { return !(*this == v); }
+};
+
+static ConstValue undef_value() { ConstValue v; v.kind = ConstValue::UNDEF; v.type = NULL; v.i = 0; v.f = 0; return v; }
+static ConstValue varying_value() { ConstValue v = undef_value(); v.kind = ConstValue::VARYING; return v; }
+static ConstValue int_value(Symbol type, long long i) { ConstValue v = undef_value(); v.kind = ConstValue::CONST; v.type = type; v.i = i; return v; }
+static ConstValue float_value(double f) { ConstValue v = undef_value(); v.kind = ConstValue::CONST; v.type = Float; v.f = f; return v; }
+
+//
+// The facts known at a program point: whether it can be reached at
+// all, and the locals holding a constant there. A local missing
+// from vars may hold anything.
+//
+struct ConstState {
+  bool reachable;
+  map<Symbol, ConstValue> vars;
+
+  ConstState() : reachable(true) {}
+  bool operator==(const ConstState &s) const { return reachable == s.reachable && vars == s.vars; }
+};
+
+static ConstState unreachable_state()
+{
+  ConstState s;
+  s.reachable = false;
+  return s;
+}
+
+// the facts holding on both of two paths merging
+static ConstState join(const ConstState &a, const ConstState &b)
+{
+  if (!a.reachable) return b;
+  if (!b.reachable) return a;
+  ConstState s;
+  for (map<Symbol, ConstValue>::const_iterator it = a.vars.begin(); it != a.vars.end(); ++it) {
+    map<Symbol, ConstValue>::const_iterator found = b.vars.find(it->first);
+    if (found != b.vars.end() && found->second == it->second) {
+      s.vars.insert(*it);
+    }
+  }
+  return s;
+}
+
+// states flowing to the exit and the next iteration of the loops
+// being analyzed, innermost last
+struct LoopFlow {
+  ConstState breaks;
+  ConstState continues;
+};
+static vector<LoopFlow> loop_flows;
+
+// the value of each expression over every time it is reached, and
+// the statements reached at all
+static map<Expr, ConstValue> expr_values;
+static set<Stmt> reached;
+
+static ConstValue record(Expr e, ConstState &s, ConstValue v)
+{
+  if (!s.reachable) {
+    return undef_value();
+  }
+  map<Expr, ConstValue>::iterator it = expr_values.find(e);
+  if (it == expr_values.end()) {
+    expr_values[e] = v;
+  } else if (it->second != v) {
+    it->second = varying_value();
+  }
+  return v;
+}
+
+//
+// Evaluate op on two constants the way the generated code would.
+// Mixed Int and Float operands, division by zero and overflowing
+// division are left to run time.
+//
+static ConstValue fold_binary(const char *op, Expr e1, ConstValue v1, Expr e2, ConstValue v2)
+{
+  string o = op;
+  if (v1.kind != ConstValue::CONST || v2.kind != ConstValue::CONST ||
+      e1->getType() != e2->getType() || v1.type != v2.type) {
+    return varying_value();
+  }
+
+  if (v1.type == Float) {
+    double a = v1.f, b = v2.f;
+    if (o == "+") return float_value(a + b);
+    if (o == "-") return float_value(a - b);
+    if (o == "*") return float_value(a * b);
+    if (o == "/") return float_value(a / b);
+    if (std::isnan(a) || std::isnan(b)) return varying_value();
+    if (o == "<") return int_value(Bool, a < b);
+    if (o == "<=") return int_value(Bool, a <= b);
+    if (o == "==") return int_value(Bool, a == b);
+    if (o == "!=") return int_value(Bool, a != b);
+    if (o == ">=") return int_value(Bool, a >= b);
+    if (o == ">") return int_value(Bool, a > b);
+    return varying_value();
+  }
+
+  long long a = v1.i, b = v2.i;
+  unsigned long long ua = a, ub = b;
+  if (v1.type == Int) {
+    if (o == "+") return int_value(Int, (long long)(ua + ub));
+    if (o == "-") return int_value(Int, (long long)(ua - ub));
+    if (o == "*") return int_value(Int, (long long)(ua * ub));
+    if ((o == "/" || o == "%") && (b == 0 || (a == LLONG_MIN && b == -1))) return varying_value();
+    if (o == "/") return int_value(Int, a / b);
+    if (o == "%") return int_value(Int, a % b);
+    if (o == "<") return int_value(Bool, a < b);
+    if (o == "<=") return int_value(Bool, a <= b);
+    if (o == ">=") return int_value(Bool, a >= b);
+    if (o == ">") return int_value(Bool, a > b);
+  }
+  if (o == "==") return int_value(Bool, a == b);
+  if (o == "!=") return int_value(Bool, a != b);
+  if (o == "&&") return int_value(v1.type, a & b);
+  if (o == "||") return int_value(v1.type, a | b);
+  if (o == "^") return int_value(v1.type, a ^ b);
+  if (o == "&") return int_value(v1.type, a & b);
+  if (o == "|") return int_value(v1.type, a | b);
+  return varying_value();
+}
+
+static ConstValue fold_unary(const char *op, ConstValue v)
+{
+  string o = op;
+  if (v.kind != ConstValue::CONST) {
+    return varying_value();
+  }
+  if (v.type == Float && o == "-") return float_value(-v.f);
+  if (v.type == Int && o == "-") return int_value(Int, (long long)(0ULL - (unsigned long long)v.i));
+  if (v.type == Int && o == "~") return int_value(Int, ~v.i);
+  if (v.type == Bool && o == "!") return int_value(Bool, !v.i);
+  return varying_value();
+}
+
+// e itself if its value is not known, else a constant for it
+static Expr fold_value(Expr e)
+{
+  map<Expr, ConstValue>::iterator it = expr_values.find(e);
+  if (it == expr_values.end() || it->second.kind != ConstValue::CONST ||
+      it->second.type != e->getType()) {
+    return e;
+  }
+  SymbolSet writes;
+  bool calls = false;
+  e->collect_effects(writes, calls);
+  if (!writes.empty()) {
+    return e;
+  }
+
+  ConstValue v = it->second;
+  Expr result;
+  char buf[64];
+  if (v.type == Float) {
+    snprintf(buf, sizeof(buf), "%.17g", v.f);
+    result = const_float(floattable.add_string(buf));
+  } else if (v.type == Bool) {
+    result = const_bool(v.i != 0);
+  } else {
+    snprintf(buf, sizeof(buf), "%lld", v.i);
+    result = const_int(inttable.add_string(buf));
+  }
+  result->set(e);
+  return result->setType(e->getType());
+}
+
+// variables live at the exit and the next iteration of the loops
+// being analyzed, innermost last
+struct LoopLive {
+  SymbolSet breaks;
+  SymbolSet continues;
+};
+static vector<LoopLive> loop_lives;
+
+static void union_with(SymbolSet &a, const SymbolSet &b)
+{
+  a.insert(b.begin(), b.end());
+}
+
+//
+// Remove assignments to locals never read afterwards, expression
+// statements without effects, statements after a return, break or
+// continue, and declarations of locals no longer used.
+//
+static void eliminate_dead_code(StmtBlock body)
+{
+  loop_lives.clear();
+  SymbolSet live;
+  body->eliminate_dead(live, true);
+}
+
+static void propagate_constants(StmtBlock body)
+{
+  expr_values.clear();
+  reached.clear();
+  loop_flows.clear();
+
+  ConstState entry;
+  body->constant_flow(entry);
+  body->fold_constants();
+}
+
+//
+// The values an Int may hold, lo <= hi. Bounds are exact: an
+// arithmetic result that might wrap around is given the full range.
+//
+struct Range {
+  long long lo, hi;
+
+  Range(long long l = LLONG_MIN, long long h = LLONG_MAX) : lo(l), hi(h) {}
+  bool operator==(const Range &r) const { return lo == r.lo && hi == r.hi; }
+  bool operator!=(const Range &r) const { return !(*this == r); }
+  bool full() const { return lo == LLONG_MIN && hi == LLONG_MAX; }
+  bool within(long long l, long long h) const { return lo >= l && hi <= h; }
+};
+
+// the range of a result computed exactly, full if it may wrap
+static Range exact_range(__int128 lo, __int128 hi)
+{
+  if (lo < LLONG_MIN || hi > LLONG_MAX) {
+    return Range();
+  }
+  return Range((long long)lo, (long long)hi);
+}
+
+//
+// Like ConstState: the ranges of the Int locals at a program point.
+// A local missing from vars may hold anything.
+//
+struct RangeState {
+  bool reachable;
+  map<Symbol, Range> vars;
+
+  RangeState() : reachable(true) {}
+  bool operator==(const RangeState &s) const { return reachable == s.reachable && vars == s.vars; }
+
+  Range get(Symbol name) const
+  {
+    map<Symbol, Range>::const_iterator it = vars.find(name);
+    return it == vars.end() ? Range() : it->second;
+  }
+  void set(Symbol name, Range r)
+  {
+    if (r.full()) {
+      vars.erase(name);
+    } else {
+      vars[name] = r;
+    }
+  }
+  // narrow name to r on a path where the condition saying so held
+  void refine(Symbol name, Range r)
+  {
+    Range old = get(name);
+    Range now(std::max(old.lo, r.lo), std::min(old.hi, r.hi));
+    if (now.lo > now.hi) {
+      reachable = false;
+    } else {
+      set(name, now);
+    }
+  }
+};
+
+static RangeState unreachable_ranges()
+{
+  RangeState s;
+  s.reachable = false;
+  return s;
+}
+
+// the ranges holding on either of two paths merging
+static RangeState join(const RangeState &a, const RangeState &b)
+{
+  if (!a.reachable) return b;
+  if (!b.reachable) return a;
+  RangeState s;
+  for (map<Symbol, Range>::const_iterator it = a.vars.begin(); it != a.vars.end(); ++it) {
+    map<Symbol, Range>::const_iterator found = b.vars.find(it->first);
+    if (found != b.vars.end()) {
+      s.set(it->first, Range(std::min(it->second.lo, found->second.lo),
+                             std::max(it->second.hi, found->second.hi)));
+    }
+  }
+  return s;
+}
+
+// a bound still moving after an iteration is given up, so that
+// loops reach their fixpoint in a few iterations
+static RangeState widen(const RangeState &old, const RangeState &now)
+{
+  if (!old.reachable) return now;
+  RangeState s = now;
+  for (map<Symbol, Range>::iterator it = s.vars.begin(); it != s.vars.end(); ++it) {
+    Range was = old.get(it->first);
+    it->second = Range(it->second.lo < was.lo ? LLONG_MIN : it->second.lo,
+                       it->second.hi > was.hi ? LLONG_MAX : it->second.hi);
+  }
+  RangeState result;
+  for (map<Symbol, Range>::iterator it = s.vars.begin(); it != s.vars.end(); ++it) {
+    result.set(it->first, it->second);
+  }
+  return result;
+}
+
+struct RangeFlow {
+  RangeState breaks;
+  RangeState continues;
+};
+static vector<RangeFlow> range_flows;
+
+// whether each division so far had both operands in [0, 2^32)
+// every time it was reached
+static map<Expr, bool> unsigned_divisions;
+
+static bool record_division(Expr e, RangeState &s, Range r1, Range r2)
+{
+  bool fits = r1.within(0, UINT_MAX) && r2.within(0, UINT_MAX);
+  map<Expr, bool>::iterator it = unsigned_divisions.find(e);
+  if (it == unsigned_divisions.end()) {
+    unsigned_divisions[e] = fits;
+  } else {
+    it->second = it->second && fits;
+  }
+  return unsigned_divisions[e];
+}
+
+// the relation op flipped for swapped operands, or negated
+static const char *swap_relation(string op)
+{
+  if (op == "<") return ">";
+  if (op == "<=") return ">=";
+  if (op == ">") return "<";
+  if (op == ">=") return "<=";
+  return op == "==" ? "==" : "!=";
+}
+
+static const char *negate_relation(string op)
+{
+  if (op == "<") return ">=";
+  if (op == "<=") return ">";
+  if (op == ">") return "<=";
+  if (op == ">=") return "<";
+  return op == "==" ? "!=" : "==";
+}
+
+// narrow a local compared against e on a path where (x op e) held
+static void refine_variable(Expr x, string op, Expr e, RangeState &s)
+{
+  Symbol name;
+  if (!x->is_variable(name) || x->getType() != Int || e->getType() != Int) {
+    return;
+  }
+  RangeState scratch = s;
+  Range r = e->evaluate_range(scratch);
+  if (op == "<" && r.hi != LLONG_MIN) s.refine(name, Range(LLONG_MIN, r.hi - 1));
+  if (op == "<=") s.refine(name, Range(LLONG_MIN, r.hi));
+  if (op == ">" && r.lo != LLONG_MAX) s.refine(name, Range(r.lo + 1, LLONG_MAX));
+  if (op == ">=") s.refine(name, Range(r.lo, LLONG_MAX));
+  if (op == "==") s.refine(name, r);
+}
+
+static void refine_comparison(Expr e1, string op, Expr e2, bool truth, RangeState &s)
+{
+  SymbolSet none;
+  if (!s.reachable || !e1->is_invariant(none) || !e2->is_invariant(none)) {
+    return;
+  }
+  if (!truth) {
+    op = negate_relation(op);
+  }
+  refine_variable(e1, op, e2, s);
+  refine_variable(e2, swap_relation(op), e1, s);
+}
+
+//
+// Find the divisions and remainders whose operands are known to be
+// non-negative and to fit in 32 bits; these are done with the much
+// cheaper unsigned 32-bit divide.
+//
+static void propagate_ranges(StmtBlock body)
+{
+  unsigned_divisions.clear();
+  range_flows.clear();
+
+  RangeState entry;
+  body->range_flow(entry);
+
+  if (cgen_debug) {
+    for (map<Expr, bool>::iterator it = unsigned_divisions.begin(); it != unsigned_divisions.end(); ++it) {
+      if (it->second) cout << "Narrowing division at line " << it->first->get_line_number() << " to 32 bits" << endl;
+    }
+  }
+}
+
+//*********************************************************
+//
+// Optimize each function
+//
+//*********************************************************
+
+void optimize_calls(Decls decls)
+{
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    if (!decls->nth(i)->isCallDecl()) {
+      globals.insert(decls->nth(i)->getName());
+    }
+  }
+
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    decls->nth(i)->optimize();
+  }
+}
+
+//
+// Order the functions so that each is followed by the callee it calls
+// most, by a depth-first walk of the call graph from main, and sort
+// them by estimated hotness: a function called at least HOT_CALLS
+// times per run (from loops or through recursion) is hot, one main
+// never reaches is unlikely to run. Counts are estimated statically
+// from loop nesting, see collect_calls.
+//
+static void place_calls(Symbol name, map<Symbol, Decl> &functions, map<Symbol, CallCounts> &graph,
+                        set<Symbol> &placed, vector<Decl> &order)
+{
+  if (placed.count(name) || !functions.count(name)) {
+    return;
+  }
+  placed.insert(name);
+  order.push_back(functions[name]);
+
+  vector<std::pair<double, Symbol> > callees;
+  for (CallCounts::iterator it = graph[name].begin(); it != graph[name].end(); ++it) {
+    callees.push_back(std::make_pair(-it->second, it->first));
+  }
+  std::stable_sort(callees.begin(), callees.end());
+  for (size_t i = 0; i < callees.size(); i++) {
+    place_calls(callees[i].second, functions, graph, placed, order);
+  }
+}
+
+// adds weight to the count of every function the subtree of n calls,
+// times LOOP_TRIPS for each loop the call is in
+static void collect_calls(const FlatTree &flat, NodeId n, CallCounts &calls, double weight)
+{
+  switch (flat.kind(n)) {
+  case WHILE_NODE:
+    weight *= LOOP_TRIPS;
+    break;
+  case FOR_NODE:
+    // the initialization runs once, the rest every trip
+    collect_calls(flat, flat.child(n, 0), calls, weight);
+    for (int k = 1; k < flat.child_count(n); k++) {
+      collect_calls(flat, flat.child(n, k), calls, weight * LOOP_TRIPS);
+    }
+    return;
+  case CALL_NODE:
+    calls[flat.symbol(n)] += weight;
+    break;
+  default:
+    break;
+  }
+  for (NodeId c : flat.children_of(n)) {
+    collect_calls(flat, c, calls, weight);
+  }
+}
+
+// whether to can be reached from from along the call graph
+static bool reaches(map<Symbol, CallCounts> &graph, Symbol from, Symbol to, set<Symbol> &seen)
+{
+  for (CallCounts::iterator it = graph[from].begin(); it != graph[from].end(); ++it) {
+    if (it->first == to) {
+      return true;
+    }
+    if (seen.insert(it->first).second && reaches(graph, it->first, to, seen)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void order_calls(Decls decls, const FlatTree &flat, vector<Decl> &order, map<Symbol, int> &heat)
+{
+  map<Symbol, Decl> functions;
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    if (decls->nth(i)->isCallDecl()) {
+      functions[decls->nth(i)->getName()] = decls->nth(i);
+    }
+  }
+  map<Symbol, CallCounts> graph;
+  for (NodeId d : flat.children_of(flat.root())) {
+    if (flat.kind(d) == CALL_DECL_NODE) {
+      collect_calls(flat, d, graph[flat.symbol(d)], 1);
+    }
+  }
+
+  // a recursive function's body runs like a loop's
+  for (map<Symbol, Decl>::iterator f = functions.begin(); f != functions.end(); ++f) {
+    set<Symbol> seen;
+    if (reaches(graph, f->first, f->first, seen)) {
+      for (CallCounts::iterator it = graph[f->first].begin(); it != graph[f->first].end(); ++it) {
+        it->second *= LOOP_TRIPS;
+      }
+    }
+  }
+
+  // calls per run: main runs once, every other function as often as
+  // its callers call it. Repeating this as many times as there are
+  // functions lets counts flow along every acyclic path; on a cycle
+  // they keep growing, up to a cap.
+  CallCounts count;
+  for (size_t round = 0; round <= functions.size(); round++) {
+    CallCounts next;
+    next[Main] = 1;
+    for (map<Symbol, CallCounts>::iterator caller = graph.begin(); caller != graph.end(); ++caller) {
+      for (CallCounts::iterator callee = caller->second.begin(); callee != caller->second.end(); ++callee) {
+        next[callee->first] = std::min(next[callee->first] + count[caller->first] * callee->second, 1e9);
+      }
+    }
+    count = next;
+  }
+
+  set<Symbol> placed;
+  place_calls(Main, functions, graph, placed, order);
+  for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+    if (decls->nth(i)->isCallDecl() && !placed.count(decls->nth(i)->getName())) {
+      order.push_back(decls->nth(i));
+    }
+  }
+
+  for (size_t i = 0; i < order.size(); i++) {
+    Symbol name = order[i]->getName();
+    heat[name] = !placed.count(name) ? UNLIKELY_FUNCTION :
+                 count[name] >= HOT_CALLS ? HOT_FUNCTION : NORMAL_FUNCTION;
+    if (cgen_debug) cout << "Placing " << name << ", estimated " << count[name] << " calls"
+                         << (heat[name] == HOT_FUNCTION ? ", hot" : heat[name] == UNLIKELY_FUNCTION ? ", unlikely" : "") << endl;
+  }
+}
+
+void CallDecl_class::optimize()
+{
+  propagate_constants(body);
+
+  int budget = UNSWITCH_BUDGET;
+  body->unswitch(budget);
+
+  ValueTable values;
+  body->value_number(values);
+  body->setVariableDecls(append_VariableDecls(body->getVariableDecls(), values.rewrite()));
+
+  eliminate_dead_code(body);
+
+  propagate_ranges(body);
+}
+
+//////////////////////////////////////////////////////////////////
+//
+//    size
+//
+//    number of AST nodes, used for code-size budgets
+//
+//////////////////////////////////////////////////////////////////
+
+int StmtBlock_class::size()
+{
+  int n = 1;
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    n += stmts->nth(i)->size();
+  }
+  return n;
+}
+
+int IfStmt_class::size() { return 1 + condition->size() + thenexpr->size() + elseexpr->size(); }
+int WhileStmt_class::size() { return 1 + condition->size() + body->size(); }
+int ForStmt_class::size() { return 1 + initexpr->size() + condition->size() + loopact->size() + body->size(); }
+int ReturnStmt_class::size() { return 1 + value->size(); }
+int ContinueStmt_class::size() { return 1; }
+int BreakStmt_class::size() { return 1; }
+
+int Call_class::size()
+{
+  int n = 1;
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    n += actuals->nth(i)->size();
+  }
+  return n;
+}
+
+int Actual_class::size() { return expr->size(); }
+int Assign_class::size() { return 1 + value->size(); }
+int Add_class::size() { return 1 + e1->size() + e2->size(); }
+int Minus_class::size() { return 1 + e1->size() + e2->size(); }
+int Multi_class::size() { return 1 + e1->size() + e2->size(); }
+int Divide_class::size() { return 1 + e1->size() + e2->size(); }
+int Mod_class::size() { return 1 + e1->size() + e2->size(); }
+int Neg_class::size() { return 1 + e1->size(); }
+int Lt_class::size() { return 1 + e1->size() + e2->size(); }
+int Le_class::size() { return 1 + e1->size() + e2->size(); }
+int Equ_class::size() { return 1 + e1->size() + e2->size(); }
+int Neq_class::size() { return 1 + e1->size() + e2->size(); }
+int Ge_class::size() { return 1 + e1->size() + e2->size(); }
+int Gt_class::size() { return 1 + e1->size() + e2->size(); }
+int And_class::size() { return 1 + e1->size() + e2->size(); }
+int Or_class::size() { return 1 + e1->size() + e2->size(); }
+int Xor_class::size() { return 1 + e1->size() + e2->size(); }
+int Not_class::size() { return 1 + e1->size(); }
+int Bitnot_class::size() { return 1 + e1->size(); }
+int Bitand_class::size() { return 1 + e1->size() + e2->size(); }
+int Bitor_class::size() { return 1 + e1->size() + e2->size(); }
+
+//////////////////////////////////////////////////////////////////
+//
+//    collect_effects
+//
+//    adds every variable the node may write to the set, and sets
+//    calls if it contains a function call. Variables declared in a
+//    block count as written, so that a condition reading a shadowed
+//    name is never treated as invariant.
+//
+//////////////////////////////////////////////////////////////////
+
+void StmtBlock_class::collect_effects(SymbolSet &writes, bool &calls)
+{
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    writes.insert(vars->nth(i)->getName());
+  }
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    stmts->nth(i)->collect_effects(writes, calls);
+  }
+}
+
+void IfStmt_class::collect_effects(SymbolSet &writes, bool &calls)
+{
+  condition->collect_effects(writes, calls);
+  thenexpr->collect_effects(writes, calls);
+  elseexpr->collect_effects(writes, calls);
+}
+
+void WhileStmt_class::collect_effects(SymbolSet &writes, bool &calls)
+{
+  condition->collect_effects(writes, calls);
+  body->collect_effects(writes, calls);
+}
+
+void ForStmt_class::collect_effects(SymbolSet &writes, bool &calls)
+{
+  initexpr->collect_effects(writes, calls);
+  condition->collect_effects(writes, calls);
+  loopact->collect_effects(writes, calls);
+  body->collect_effects(writes, calls);
+}
+
+void ReturnStmt_class::collect_effects(SymbolSet &writes, bool &calls) { value->collect_effects(writes, calls); }
+void ContinueStmt_class::collect_effects(SymbolSet &writes, bool &calls) {}
+void BreakStmt_class::collect_effects(SymbolSet &writes, bool &calls) {}
+
+void Call_class::collect_effects(SymbolSet &writes, bool &calls)
+{
+  if (name != print) {
+    calls = true;
+  }
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->collect_effects(writes, calls);
+  }
+}
+
+void Actual_class::collect_effects(SymbolSet &writes, bool &calls) { expr->collect_effects(writes, calls); }
+
+void Assign_class::collect_effects(SymbolSet &writes, bool &calls)
+{
+  writes.insert(lvalue);
+  value->collect_effects(writes, calls);
+}
+
+void Add_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Minus_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Multi_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Divide_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Mod_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Neg_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); }
+void Lt_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Le_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Equ_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Neq_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Ge_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Gt_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void And_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Or_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Xor_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Not_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); }
+void Bitnot_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); }
+void Bitand_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+void Bitor_class::collect_effects(SymbolSet &writes, bool &calls) { e1->collect_effects(writes, calls); e2->collect_effects(writes, calls); }
+
+//////////////////////////////////////////////////////////////////
+//
+//    is_invariant
+//
+//    true if the expression reads none of the variant variables and
+//    may be evaluated once ahead of the loop: no calls, assignments
+//    or divisions that could trap when hoisted out of a loop that
+//    never runs. With an empty set, true if the expression has no
+//    effect at all.
+//
+//////////////////////////////////////////////////////////////////
+
+// a constant divisor other than 0 and -1 never traps
+static bool safe_divisor(Expr e)
+{
+  long long d;
+  return e->is_const_int(d) && d != 0 && d != -1;
+}
+
+bool Call_class::is_invariant(SymbolSet &variant) { return false; }
+bool Actual_class::is_invariant(SymbolSet &variant) { return expr->is_invariant(variant); }
+bool Assign_class::is_invariant(SymbolSet &variant) { return false; }
+bool Add_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Minus_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Multi_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Divide_class::is_invariant(SymbolSet &variant) { return safe_divisor(e2) && e1->is_invariant(variant); }
+bool Mod_class::is_invariant(SymbolSet &variant) { return safe_divisor(e2) && e1->is_invariant(variant); }
+bool Neg_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant); }
+bool Lt_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Le_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Equ_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Neq_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Ge_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Gt_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool And_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Or_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Xor_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Not_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant); }
+bool Bitnot_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant); }
+bool Bitand_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Bitor_class::is_invariant(SymbolSet &variant) { return e1->is_invariant(variant) && e2->is_invariant(variant); }
+bool Object_class::is_invariant(SymbolSet &variant) { return variant.find(var) == variant.end(); }
+
+bool Assign_class::is_assign(Symbol &var, int &var_slot, Expr &v)
+{
+  var = lvalue;
+  var_slot = slot;
+  v = value;
+  return true;
+}
+
+bool Const_bool_class::is_const_bool(Boolean &v)
+{
+  v = value;
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////
+//
+//    find_invariant_if
+//
+//    the first if statement whose condition is invariant in the
+//    enclosing loop. Nested loops are not searched; they have been
+//    unswitched already.
+//
+//////////////////////////////////////////////////////////////////
+
+IfStmt StmtBlock_class::find_invariant_if(SymbolSet &variant)
+{
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    IfStmt found = stmts->nth(i)->find_invariant_if(variant);
+    if (found != NULL) {
+      return found;
+    }
+  }
+  return NULL;
+}
+
+IfStmt IfStmt_class::find_invariant_if(SymbolSet &variant)
+{
+  Boolean v;
+  if (!condition->is_const_bool(v) && condition->is_invariant(variant)) {
+    return this;
+  }
+  IfStmt found = thenexpr->find_invariant_if(variant);
+  if (found == NULL) {
+    found = elseexpr->find_invariant_if(variant);
+  }
+  return found;
+}
+
+IfStmt WhileStmt_class::find_invariant_if(SymbolSet &variant) { return NULL; }
+IfStmt ForStmt_class::find_invariant_if(SymbolSet &variant) { return NULL; }
+IfStmt ReturnStmt_class::find_invariant_if(SymbolSet &variant) { return NULL; }
+IfStmt ContinueStmt_class::find_invariant_if(SymbolSet &variant) { return NULL; }
+IfStmt BreakStmt_class::find_invariant_if(SymbolSet &variant) { return NULL; }
+
+//////////////////////////////////////////////////////////////////
+//
+//    unswitch
+//
+//    returns the statement to replace this one with. Loops are
+//    unswitched innermost first; ifs on a constant condition (left
+//    behind in the specialized copies) are replaced by the branch
+//    they take.
+//
+//////////////////////////////////////////////////////////////////
+
+Stmt StmtBlock_class::unswitch(int &budget)
+{
+  Stmts result = nil_Stmts();
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    result = append_Stmts(result, single_Stmts(stmts->nth(i)->unswitch(budget)));
+  }
+  stmts = result;
+  return this;
+}
+
+Stmt IfStmt_class::unswitch(int &budget)
+{
+  Boolean v;
+  if (condition->is_const_bool(v)) {
+    return v ? thenexpr->unswitch(budget) : elseexpr->unswitch(budget);
+  }
+  thenexpr->unswitch(budget);
+  elseexpr->unswitch(budget);
+  return this;
+}
+
+Stmt WhileStmt_class::unswitch(int &budget)
+{
+  body->unswitch(budget);
+
+  SymbolSet variant;
+  loop_variant(this, variant);
+  IfStmt inner = body->find_invariant_if(variant);
+  if (inner == NULL || size() > budget) {
+    return this;
+  }
+  budget -= size();
+  return unswitch_loop(this, inner, budget);
+}
+
+Stmt ForStmt_class::unswitch(int &budget)
+{
+  body->unswitch(budget);
+
+  SymbolSet variant;
+  loop_variant(this, variant);
+  IfStmt inner = body->find_invariant_if(variant);
+  if (inner == NULL || size() > budget) {
+    return this;
+  }
+  budget -= size();
+  return unswitch_loop(this, inner, budget);
+}
+
+Stmt ReturnStmt_class::unswitch(int &budget) { return this; }
+Stmt ContinueStmt_class::unswitch(int &budget) { return this; }
+Stmt BreakStmt_class::unswitch(int &budget) { return this; }
+
+//////////////////////////////////////////////////////////////////
+//
+//    constant_flow
+//
+//    sparse conditional constant propagation over the structured
+//    control flow. Only the branches a known condition can take are
+//    followed; loops are iterated until the state at their head
+//    stops changing. Globals are never tracked, any call may write
+//    them.
+//
+//////////////////////////////////////////////////////////////////
+
+void StmtBlock_class::constant_flow(ConstState &s)
+{
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    s.vars.erase(vars->nth(i)->getName());
+  }
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    if (s.reachable) {
+      reached.insert(stmts->nth(i));
+    }
+    stmts->nth(i)->constant_flow(s);
+  }
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    s.vars.erase(vars->nth(i)->getName());
+  }
+}
+
+void IfStmt_class::constant_flow(ConstState &s)
+{
+  ConstValue v = condition->evaluate(s);
+  ConstState then_state = s, else_state = s;
+  if (v.kind == ConstValue::CONST) {
+    (v.i ? else_state : then_state).reachable = false;
+  }
+  thenexpr->constant_flow(then_state);
+  elseexpr->constant_flow(else_state);
+  s = join(then_state, else_state);
+}
+
+void WhileStmt_class::constant_flow(ConstState &s)
+{
+  ConstState back = unreachable_state();
+  loop_flows.push_back(LoopFlow());
+  for (;;) {
+    ConstState head = join(s, back);
+    ConstValue v = condition->evaluate(head);
+    ConstState body_state = head, exit_state = head;
+    if (v.kind == ConstValue::CONST) {
+      (v.i ? exit_state : body_state).reachable = false;
+    }
+
+    loop_flows.back().breaks = unreachable_state();
+    loop_flows.back().continues = unreachable_state();
+    body->constant_flow(body_state);
+
+    ConstState next = join(back, join(body_state, loop_flows.back().continues));
+    if (next == back) {
+      s = join(exit_state, loop_flows.back().breaks);
+      break;
+    }
+    back = next;
+  }
+  loop_flows.pop_back();
+}
+
+void ForStmt_class::constant_flow(ConstState &s)
+{
+  initexpr->constant_flow(s);
+
+  ConstState back = unreachable_state();
+  loop_flows.push_back(LoopFlow());
+  for (;;) {
+    ConstState head = join(s, back);
+    ConstValue v = condition->evaluate(head);
+    ConstState body_state = head, exit_state = head;
+    if (v.kind == ConstValue::CONST) {
+      (v.i ? exit_state : body_state).reachable = false;
+    }
+
+    loop_flows.back().breaks = unreachable_state();
+    loop_flows.back().continues = unreachable_state();
+    body->constant_flow(body_state);
+    ConstState act_state = join(body_state, loop_flows.back().continues);
+    loopact->constant_flow(act_state);
+
+    ConstState next = join(back, act_state);
+    if (next == back) {
+      s = join(exit_state, loop_flows.back().breaks);
+      break;
+    }
+    back = next;
+  }
+  loop_flows.pop_back();
+}
+
+void ReturnStmt_class::constant_flow(ConstState &s)
+{
+  value->evaluate(s);
+  s.reachable = false;
+}
+
+void ContinueStmt_class::constant_flow(ConstState &s)
+{
+  loop_flows.back().continues = join(loop_flows.back().continues, s);
+  s.reachable = false;
+}
+
+void BreakStmt_class::constant_flow(ConstState &s)
+{
+  loop_flows.back().breaks = join(loop_flows.back().breaks, s);
+  s.reachable = false;
+}
+
+void Expr_class::constant_flow(ConstState &s) { evaluate(s); }
+
+//////////////////////////////////////////////////////////////////
+//
+//    evaluate
+//
+//    the value of the expression in state s, which it updates with
+//    the assignments the expression makes
+//
+//////////////////////////////////////////////////////////////////
+
+ConstValue Expr_class::evaluate(ConstState &s) { return record(this, s, varying_value()); }
+
+ConstValue Call_class::evaluate(ConstState &s)
+{
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->evaluate(s);
+  }
+  return record(this, s, varying_value());
+}
+
+ConstValue Actual_class::evaluate(ConstState &s) { return record(this, s, expr->evaluate(s)); }
+
+ConstValue Assign_class::evaluate(ConstState &s)
+{
+  ConstValue v = value->evaluate(s);
+  if (s.reachable) {
+    if (v.kind == ConstValue::CONST && globals.find(lvalue) == globals.end()) {
+      s.vars[lvalue] = v;
+    } else {
+      s.vars.erase(lvalue);
+    }
+  }
+  return record(this, s, v);
+}
+
+ConstValue Object_class::evaluate(ConstState &s)
+{
+  map<Symbol, ConstValue>::iterator it = s.vars.find(var);
+  if (it == s.vars.end() || it->second.type != type) {
+    return record(this, s, varying_value());
+  }
+  return record(this, s, it->second);
+}
+
+ConstValue Const_int_class::evaluate(ConstState &s) { return record(this, s, int_value(Int, strtoll(value->get_string(), NULL, 0))); }
+ConstValue Const_float_class::evaluate(ConstState &s) { return record(this, s, float_value(atof(value->get_string()))); }
+ConstValue Const_bool_class::evaluate(ConstState &s) { return record(this, s, int_value(Bool, value ? 1 : 0)); }
+
+ConstValue Add_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("+", e1, v1, e2, v2)); }
+ConstValue Minus_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("-", e1, v1, e2, v2)); }
+ConstValue Multi_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("*", e1, v1, e2, v2)); }
+ConstValue Divide_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("/", e1, v1, e2, v2)); }
+ConstValue Mod_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("%", e1, v1, e2, v2)); }
+ConstValue Neg_class::evaluate(ConstState &s) { return record(this, s, fold_unary("-", e1->evaluate(s))); }
+ConstValue Lt_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("<", e1, v1, e2, v2)); }
+ConstValue Le_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("<=", e1, v1, e2, v2)); }
+ConstValue Equ_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("==", e1, v1, e2, v2)); }
+ConstValue Neq_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("!=", e1, v1, e2, v2)); }
+ConstValue Ge_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary(">=", e1, v1, e2, v2)); }
+ConstValue Gt_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary(">", e1, v1, e2, v2)); }
+ConstValue And_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("&&", e1, v1, e2, v2)); }
+ConstValue Or_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("||", e1, v1, e2, v2)); }
+ConstValue Xor_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("^", e1, v1, e2, v2)); }
+ConstValue Not_class::evaluate(ConstState &s) { return record(this, s, fold_unary("!", e1->evaluate(s))); }
+ConstValue Bitnot_class::evaluate(ConstState &s) { return record(this, s, fold_unary("~", e1->evaluate(s))); }
+ConstValue Bitand_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("&", e1, v1, e2, v2)); }
+ConstValue Bitor_class::evaluate(ConstState &s) { ConstValue v1 = e1->evaluate(s); ConstValue v2 = e2->evaluate(s); return record(this, s, fold_binary("|", e1, v1, e2, v2)); }
+
+//////////////////////////////////////////////////////////////////
+//
+//    fold_constants / fold
+//
+//    replaces expressions found constant by their value, ifs and
+//    loops on a constant condition by what they execute, and drops
+//    statements never reached
+//
+//////////////////////////////////////////////////////////////////
+
+Stmt StmtBlock_class::fold_constants()
+{
+  Stmts result = nil_Stmts();
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    if (reached.find(stmts->nth(i)) != reached.end()) {
+      result = append_Stmts(result, single_Stmts(stmts->nth(i)->fold_constants()));
+    }
+  }
+  stmts = result;
+  return this;
+}
+
+Stmt IfStmt_class::fold_constants()
+{
+  condition = condition->fold();
+  Boolean v;
+  if (condition->is_const_bool(v)) {
+    return v ? thenexpr->fold_constants() : elseexpr->fold_constants();
+  }
+  thenexpr->fold_constants();
+  elseexpr->fold_constants();
+  return this;
+}
+
+Stmt WhileStmt_class::fold_constants()
+{
+  condition = condition->fold();
+  Boolean v;
+  if (condition->is_const_bool(v) && !v) {
+    return stmtBlock(nil_VariableDecls(), nil_Stmts());
+  }
+  body->fold_constants();
+  return this;
+}
+
+Stmt ForStmt_class::fold_constants()
+{
+  initexpr = initexpr->fold();
+  condition = condition->fold();
+  Boolean v;
+  if (condition->is_const_bool(v) && !v) {
+    return initexpr;
+  }
+  loopact = loopact->fold();
+  body->fold_constants();
+  return this;
+}
+
+Stmt ReturnStmt_class::fold_constants()
+{
+  value = value->fold();
+  return this;
+}
+
+Stmt ContinueStmt_class::fold_constants() { return this; }
+Stmt BreakStmt_class::fold_constants() { return this; }
+
+Expr Call_class::fold()
+{
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->fold();
+  }
+  return this;
+}
+
+Expr Actual_class::fold()
+{
+  expr = expr->fold();
+  return this;
+}
+
+Expr Assign_class::fold()
+{
+  value = value->fold();
+  return this;
+}
+
+Expr Object_class::fold() { return fold_value(this); }
+Expr Add_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Minus_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Multi_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Divide_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Mod_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Neg_class::fold() { e1 = e1->fold(); return fold_value(this); }
+Expr Lt_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Le_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Equ_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Neq_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Ge_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Gt_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr And_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Or_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Xor_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Not_class::fold() { e1 = e1->fold(); return fold_value(this); }
+Expr Bitnot_class::fold() { e1 = e1->fold(); return fold_value(this); }
+Expr Bitand_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+Expr Bitor_class::fold() { e1 = e1->fold(); e2 = e2->fold(); return fold_value(this); }
+
+bool Const_int_class::is_const_int(long long &v)
+{
+  v = strtoll(value->get_string(), NULL, 0);
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////
+//
+//    value_number
+//
+//    walks the function in evaluation order, looking up each
+//    expression in the table before its operands. slot is where the
+//    expression hangs in its parent, NULL when its value is unused.
+//    Loops first kill everything they may write, so that entries
+//    made before a loop stay valid inside it.
+//
+//////////////////////////////////////////////////////////////////
+
+void StmtBlock_class::value_number(ValueTable &t)
+{
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    t.kill(vars->nth(i)->getName());
+  }
+  t.enterscope();
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    stmts->nth(i)->value_number(t);
+  }
+  t.exitscope();
+}
+
+void IfStmt_class::value_number(ValueTable &t)
+{
+  condition->value_number(t, &condition);
+  t.enterscope();
+  thenexpr->value_number(t);
+  t.exitscope();
+  t.enterscope();
+  elseexpr->value_number(t);
+  t.exitscope();
+}
+
+void WhileStmt_class::value_number(ValueTable &t)
+{
+  SymbolSet variant;
+  loop_variant(this, variant);
+  t.kill(variant);
+
+  t.enterscope();
+  condition->value_number(t, &condition);
+  body->value_number(t);
+  t.exitscope();
+}
+
+// loopact is reached through continue, so it only sees values
+// computed before the body
+void ForStmt_class::value_number(ValueTable &t)
+{
+  initexpr->value_number(t);
+
+  SymbolSet variant;
+  loop_variant(this, variant);
+  t.kill(variant);
+
+  t.enterscope();
+  condition->value_number(t, &condition);
+  t.enterscope();
+  body->value_number(t);
+  t.exitscope();
+  loopact->value_number(t);
+  t.exitscope();
+}
+
+void ReturnStmt_class::value_number(ValueTable &t) { value->value_number(t, &value); }
+void ContinueStmt_class::value_number(ValueTable &t) {}
+void BreakStmt_class::value_number(ValueTable &t) {}
+
+// a call other than printf may write any global
+void Call_class::value_number(ValueTable &t, Expr *slot)
+{
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->value_number(t, NULL);
+  }
+  if (name != print) {
+    t.kill(globals);
+  }
+}
+
+void Actual_class::value_number(ValueTable &t, Expr *slot) { expr->value_number(t, &expr); }
+
+void Assign_class::value_number(ValueTable &t, Expr *slot)
+{
+  value->value_number(t, &value);
+  t.kill(lvalue);
+}
+
+void Add_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Minus_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Multi_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Divide_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Mod_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Neg_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); t.define(this, slot); } }
+void Lt_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Le_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Equ_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Neq_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Ge_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Gt_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void And_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Or_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Xor_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Not_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); t.define(this, slot); } }
+void Bitnot_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); t.define(this, slot); } }
+void Bitand_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+void Bitor_class::value_number(ValueTable &t, Expr *slot) { if (!t.reuse(this, slot)) { e1->value_number(t, &e1); e2->value_number(t, &e2); t.define(this, slot); } }
+
+//////////////////////////////////////////////////////////////////
+//
+//    value_key
+//
+//    a string naming the value an expression computes, empty if
+//    the expression has side effects or is not worth numbering.
+//    Operands of commutative operators are put in a fixed order.
+//
+//////////////////////////////////////////////////////////////////
+
+static string binary_key(const char *op, Expr e1, Expr e2, bool commutative)
+{
+  string k1 = e1->value_key(), k2 = e2->value_key();
+  if (k1.empty() || k2.empty()) {
+    return "";
+  }
+  if (commutative && k2 < k1) {
+    swap(k1, k2);
+  }
+  return string("(") + op + " " + k1 + " " + k2 + ")";
+}
+
+static string unary_key(const char *op, Expr e1)
+{
+  string k1 = e1->value_key();
+  return k1.empty() ? k1 : string("(") + op + " " + k1 + ")";
+}
+
+string Object_class::value_key() { return var->get_string(); }
+string Const_int_class::value_key() { return string("$") + value->get_string(); }
+string Const_float_class::value_key() { return string("$") + value->get_string(); }
+string Const_bool_class::value_key() { return value ? "$true" : "$false"; }
+string Add_class::value_key() { return binary_key("+", e1, e2, true); }
+string Minus_class::value_key() { return binary_key("-", e1, e2, false); }
+string Multi_class::value_key() { return binary_key("*", e1, e2, true); }
+string Divide_class::value_key() { return binary_key("/", e1, e2, false); }
+string Mod_class::value_key() { return binary_key("%", e1, e2, false); }
+string Neg_class::value_key() { return unary_key("-", e1); }
+string Lt_class::value_key() { return binary_key("<", e1, e2, false); }
+string Le_class::value_key() { return binary_key("<=", e1, e2, false); }
+string Equ_class::value_key() { return binary_key("==", e1, e2, true); }
+string Neq_class::value_key() { return binary_key("!=", e1, e2, true); }
+string Ge_class::value_key() { return binary_key(">=", e1, e2, false); }
+string Gt_class::value_key() { return binary_key(">", e1, e2, false); }
+string And_class::value_key() { return binary_key("&&", e1, e2, true); }
+string Or_class::value_key() { return binary_key("||", e1, e2, true); }
+string Xor_class::value_key() { return binary_key("^", e1, e2, true); }
+string Not_class::value_key() { return unary_key("!", e1); }
+string Bitnot_class::value_key() { return unary_key("~", e1); }
+string Bitand_class::value_key() { return binary_key("&", e1, e2, true); }
+string Bitor_class::value_key() { return binary_key("|", e1, e2, true); }
+
+//////////////////////////////////////////////////////////////////
+//
+//    collect_uses
+//
+//    adds every variable the node reads to the set
+//
+//////////////////////////////////////////////////////////////////
+
+void StmtBlock_class::collect_uses(SymbolSet &uses)
+{
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    stmts->nth(i)->collect_uses(uses);
+  }
+}
+
+void IfStmt_class::collect_uses(SymbolSet &uses)
+{
+  condition->collect_uses(uses);
+  thenexpr->collect_uses(uses);
+  elseexpr->collect_uses(uses);
+}
+
+void WhileStmt_class::collect_uses(SymbolSet &uses)
+{
+  condition->collect_uses(uses);
+  body->collect_uses(uses);
+}
+
+void ForStmt_class::collect_uses(SymbolSet &uses)
+{
+  initexpr->collect_uses(uses);
+  condition->collect_uses(uses);
+  loopact->collect_uses(uses);
+  body->collect_uses(uses);
+}
+
+void ReturnStmt_class::collect_uses(SymbolSet &uses) { value->collect_uses(uses); }
+void ContinueStmt_class::collect_uses(SymbolSet &uses) {}
+void BreakStmt_class::collect_uses(SymbolSet &uses) {}
+
+void Call_class::collect_uses(SymbolSet &uses)
+{
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->collect_uses(uses);
+  }
+}
+
+void Actual_class::collect_uses(SymbolSet &uses) { expr->collect_uses(uses); }
+void Assign_class::collect_uses(SymbolSet &uses) { value->collect_uses(uses); }
+void Object_class::collect_uses(SymbolSet &uses) { uses.insert(var); }
+void Add_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Minus_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Multi_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Divide_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Mod_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Neg_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); }
+void Lt_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Le_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Equ_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Neq_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Ge_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Gt_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void And_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Or_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Xor_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Not_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); }
+void Bitnot_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); }
+void Bitand_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+void Bitor_class::collect_uses(SymbolSet &uses) { e1->collect_uses(uses); e2->collect_uses(uses); }
+
+//////////////////////////////////////////////////////////////////
+//
+//    eliminate_dead
+//
+//    backward liveness: live holds the variables read after the
+//    statement and is updated to those read before it. Returns the
+//    statement to keep in its place, NULL if none; blocks only
+//    rewrite themselves when remove is set, so the same walk serves
+//    to find the fixpoint at loop heads. Globals are never removed.
+//
+//////////////////////////////////////////////////////////////////
+
+Stmt StmtBlock_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  vector<Stmt> list;
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    Stmt stmt = stmts->nth(i);
+    list.push_back(stmt);
+    if (stmt->isReturn() || stmt->isBreak() || stmt->isContinue()) {
+      break;
+    }
+  }
+
+  // a local of the block hides the variable of that name outside it:
+  // it is dead at the end of the block, and the outer variable is live
+  // at its start if it is live at any way out of the block
+  SymbolSet outer_live;
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    Symbol name = vars->nth(i)->getName();
+    bool out = live.find(name) != live.end();
+    for (size_t j = 0; j < loop_lives.size() && !out; j++) {
+      out = loop_lives[j].breaks.count(name) || loop_lives[j].continues.count(name);
+    }
+    if (out) {
+      outer_live.insert(name);
+    }
+    live.erase(name);
+  }
+
+  vector<Stmt> kept;
+  for (size_t i = list.size(); i-- > 0; ) {
+    Stmt stmt = list[i]->eliminate_dead(live, remove);
+    if (stmt != NULL) {
+      kept.push_back(stmt);
+    }
+  }
+
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    live.erase(vars->nth(i)->getName());
+  }
+  union_with(live, outer_live);
+  if (!remove) {
+    return this;
+  }
+
+  stmts = nil_Stmts();
+  for (size_t i = kept.size(); i-- > 0; ) {
+    stmts = append_Stmts(stmts, single_Stmts(kept[i]));
+  }
+
+  SymbolSet used;
+  bool calls = false;
+  collect_uses(used);
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    stmts->nth(i)->collect_effects(used, calls);
+  }
+  VariableDecls decls = nil_VariableDecls();
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    if (used.find(vars->nth(i)->getName()) != used.end()) {
+      decls = append_VariableDecls(decls, single_VariableDecls(vars->nth(i)));
+    }
+  }
+  vars = decls;
+  return this;
+}
+
+Stmt IfStmt_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  SymbolSet else_live = live;
+  thenexpr->eliminate_dead(live, remove);
+  elseexpr->eliminate_dead(else_live, remove);
+  union_with(live, else_live);
+  condition->collect_uses(live);
+  return this;
+}
+
+Stmt WhileStmt_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  SymbolSet head = live;
+  for (;;) {
+    SymbolSet body_live = head;
+    loop_lives.push_back(LoopLive());
+    loop_lives.back().breaks = live;
+    loop_lives.back().continues = head;
+    body->eliminate_dead(body_live, false);
+    loop_lives.pop_back();
+
+    union_with(body_live, live);
+    condition->collect_uses(body_live);
+    if (body_live == head) {
+      break;
+    }
+    head = body_live;
+  }
+
+  if (remove) {
+    SymbolSet body_live = head;
+    loop_lives.push_back(LoopLive());
+    loop_lives.back().breaks = live;
+    loop_lives.back().continues = head;
+    body->eliminate_dead(body_live, true);
+    loop_lives.pop_back();
+  }
+  live = head;
+  return this;
+}
+
+// continue goes to loopact, so the body ends where loopact starts
+Stmt ForStmt_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  SymbolSet head = live;
+  for (;;) {
+    SymbolSet act_live = head;
+    loopact->eliminate_dead(act_live, false);
+    SymbolSet body_live = act_live;
+    loop_lives.push_back(LoopLive());
+    loop_lives.back().breaks = live;
+    loop_lives.back().continues = act_live;
+    body->eliminate_dead(body_live, false);
+    loop_lives.pop_back();
+
+    union_with(body_live, live);
+    condition->collect_uses(body_live);
+    if (body_live == head) {
+      break;
+    }
+    head = body_live;
+  }
+
+  if (remove) {
+    SymbolSet act_live = head;
+    loopact->eliminate_dead(act_live, false);
+    SymbolSet body_live = act_live;
+    loop_lives.push_back(LoopLive());
+    loop_lives.back().breaks = live;
+    loop_lives.back().continues = act_live;
+    body->eliminate_dead(body_live, true);
+    loop_lives.pop_back();
+  }
+  live = head;
+  initexpr->eliminate_dead(live, false);
+  return this;
+}
+
+Stmt ReturnStmt_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  live.clear();
+  value->collect_uses(live);
+  return this;
+}
+
+Stmt ContinueStmt_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  live = loop_lives.back().continues;
+  return this;
+}
+
+Stmt BreakStmt_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  live = loop_lives.back().breaks;
+  return this;
+}
+
+// an expression statement is dropped if it has no effect
+Stmt Expr_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  SymbolSet none;
+  if (is_invariant(none)) {
+    return NULL;
+  }
+  collect_uses(live);
+  return this;
+}
+
+// a dead assignment leaves only its value, to be dropped in turn if
+// it has no effect
+Stmt Assign_class::eliminate_dead(SymbolSet &live, bool remove)
+{
+  if (live.find(lvalue) == live.end() && globals.find(lvalue) == globals.end()) {
+    if (cgen_debug && remove) cout << "Removing dead store to " << lvalue << " at line " << get_line_number() << endl;
+    return value->eliminate_dead(live, remove);
+  }
+  live.erase(lvalue);
+  value->collect_uses(live);
+  return this;
+}
+
+//////////////////////////////////////////////////////////////////
+//
+//    range_flow / evaluate_range / refine_range
+//
+//    value range propagation over the structured control flow, in
+//    the same shape as constant_flow. Conditions comparing a local
+//    narrow its range on the branch where they hold; loop heads are
+//    widened so the iteration ends. Divisions and remainders note
+//    the ranges of their operands as they are reached.
+//
+//////////////////////////////////////////////////////////////////
+
+void StmtBlock_class::range_flow(RangeState &s)
+{
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    s.vars.erase(vars->nth(i)->getName());
+  }
+  for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+    stmts->nth(i)->range_flow(s);
+  }
+  for (int i=vars->first(); vars->more(i); i=vars->next(i)) {
+    s.vars.erase(vars->nth(i)->getName());
+  }
+}
+
+void IfStmt_class::range_flow(RangeState &s)
+{
+  condition->evaluate_range(s);
+  RangeState then_state = s, else_state = s;
+  condition->refine_range(then_state, true);
+  condition->refine_range(else_state, false);
+  thenexpr->range_flow(then_state);
+  elseexpr->range_flow(else_state);
+  s = join(then_state, else_state);
+}
+
+void WhileStmt_class::range_flow(RangeState &s)
+{
+  RangeState back = unreachable_ranges();
+  range_flows.push_back(RangeFlow());
+  for (;;) {
+    RangeState head = join(s, back);
+    condition->evaluate_range(head);
+    RangeState body_state = head, exit_state = head;
+    condition->refine_range(body_state, true);
+    condition->refine_range(exit_state, false);
+
+    range_flows.back().breaks = unreachable_ranges();
+    range_flows.back().continues = unreachable_ranges();
+    body->range_flow(body_state);
+
+    RangeState next = widen(back, join(back, join(body_state, range_flows.back().continues)));
+    if (next == back) {
+      s = join(exit_state, range_flows.back().breaks);
+      break;
+    }
+    back = next;
+  }
+  range_flows.pop_back();
+}
+
+void ForStmt_class::range_flow(RangeState &s)
+{
+  initexpr->evaluate_range(s);
+
+  RangeState back = unreachable_ranges();
+  range_flows.push_back(RangeFlow());
+  for (;;) {
+    RangeState head = join(s, back);
+    condition->evaluate_range(head);
+    RangeState body_state = head, exit_state = head;
+    condition->refine_range(body_state, true);
+    condition->refine_range(exit_state, false);
+
+    range_flows.back().breaks = unreachable_ranges();
+    range_flows.back().continues = unreachable_ranges();
+    body->range_flow(body_state);
+    RangeState act_state = join(body_state, range_flows.back().continues);
+    loopact->evaluate_range(act_state);
+
+    RangeState next = widen(back, join(back, act_state));
+    if (next == back) {
+      s = join(exit_state, range_flows.back().breaks);
+      break;
+    }
+    back = next;
+  }
+  range_flows.pop_back();
+}
+
+void ReturnStmt_class::range_flow(RangeState &s)
+{
+  value->evaluate_range(s);
+  s.reachable = false;
+}
+
+void ContinueStmt_class::range_flow(RangeState &s)
+{
+  range_flows.back().continues = join(range_flows.back().continues, s);
+  s.reachable = false;
+}
+
+void BreakStmt_class::range_flow(RangeState &s)
+{
+  range_flows.back().breaks = join(range_flows.back().breaks, s);
+  s.reachable = false;
+}
+
+void Expr_class::range_flow(RangeState &s) { evaluate_range(s); }
+
+Range Expr_class::evaluate_range(RangeState &s) { return Range(); }
+
+Range Call_class::evaluate_range(RangeState &s)
+{
+  for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+    actuals->nth(i)->evaluate_range(s);
+  }
+  return Range();
+}
+
+Range Actual_class::evaluate_range(RangeState &s) { return expr->evaluate_range(s); }
+
+Range Assign_class::evaluate_range(RangeState &s)
+{
+  Range r = value->evaluate_range(s);
+  if (value->getType() != Int || globals.find(lvalue) != globals.end()) {
+    r = Range();
+  }
+  s.set(lvalue, r);
+  return r;
+}
+
+Range Object_class::evaluate_range(RangeState &s) { return type == Int ? s.get(var) : Range(); }
+
+Range Const_int_class::evaluate_range(RangeState &s)
+{
+  long long v = strtoll(value->get_string(), NULL, 0);
+  return Range(v, v);
+}
+
+Range Add_class::evaluate_range(RangeState &s)
+{
+  Range r1 = e1->evaluate_range(s);
+  Range r2 = e2->evaluate_range(s);
+  if (e1->getType() != Int || e2->getType() != Int) {
+    return Range();
+  }
+  return exact_range((__int128)r1.lo + r2.lo, (__int128)r1.hi + r2.hi);
+}
+
+Range Minus_class::evaluate_range(RangeState &s)
+{
+  Range r1 = e1->evaluate_range(s);
+  Range r2 = e2->evaluate_range(s);
+  if (e1->getType() != Int || e2->getType() != Int) {
+    return Range();
+  }
+  return exact_range((__int128)r1.lo - r2.hi, (__int128)r1.hi - r2.lo);
+}
+
+Range Multi_class::evaluate_range(RangeState &s)
+{
+  Range r1 = e1->evaluate_range(s);
+  Range r2 = e2->evaluate_range(s);
+  if (e1->getType() != Int || e2->getType() != Int) {
+    return Range();
+  }
+  __int128 p[4] = { (__int128)r1.lo * r2.lo, (__int128)r1.lo * r2.hi,
+                    (__int128)r1.hi * r2.lo, (__int128)r1.hi * r2.hi };
+  return exact_range(*std::min_element(p, p + 4), *std::max_element(p, p + 4));
+}
+
+Range Divide_class::evaluate_range(RangeState &s)
+{
+  Range r1 = e1->evaluate_range(s);
+  Range r2 = e2->evaluate_range(s);
+  if (e1->getType() != Int || e2->getType() != Int) {
+    return Range();
+  }
+  if (s.reachable) {
+    unsigned_operands = record_division(this, s, r1, r2);
+  }
+  if (r1.lo >= 0 && r2.lo >= 1) {
+    return Range(r1.lo / r2.hi, r1.hi / r2.lo);
+  }
+  return Range();
+}
+
+Range Mod_class::evaluate_range(RangeState &s)
+{
+  Range r1 = e1->evaluate_range(s);
+  Range r2 = e2->evaluate_range(s);
+  if (e1->getType() != Int || e2->getType() != Int) {
+    return Range();
+  }
+  if (s.reachable) {
+    unsigned_operands = record_division(this, s, r1, r2);
+  }
+  if (r2.lo < 1) {
+    return Range();
+  }
+  // the remainder takes the sign of the dividend
+  long long m = r2.hi - 1;
+  return Range(r1.lo >= 0 ? 0 : std::max(r1.lo, -m), r1.hi <= 0 ? 0 : std::min(r1.hi, m));
+}
+
+Range Neg_class::evaluate_range(RangeState &s)
+{
+  Range r = e1->evaluate_range(s);
+  if (e1->getType() != Int) {
+    return Range();
+  }
+  return exact_range(-(__int128)r.hi, -(__int128)r.lo);
+}
+
+Range Bitand_class::evaluate_range(RangeState &s)
+{
+  Range r1 = e1->evaluate_range(s);
+  Range r2 = e2->evaluate_range(s);
+  if (e1->getType() != Int || e2->getType() != Int) {
+    return Range();
+  }
+  if (r1.lo >= 0 && r2.lo >= 0) return Range(0, std::min(r1.hi, r2.hi));
+  if (r1.lo >= 0) return Range(0, r1.hi);
+  if (r2.lo >= 0) return Range(0, r2.hi);
+  return Range();
+}
+
+Range Lt_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Le_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Equ_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Neq_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Ge_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Gt_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range And_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Or_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Xor_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Bitor_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); e2->evaluate_range(s); return Range(); }
+Range Not_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); return Range(); }
+Range Bitnot_class::evaluate_range(RangeState &s) { e1->evaluate_range(s); return Range(); }
+
+void Lt_class::refine_range(RangeState &s, bool truth) { refine_comparison(e1, "<", e2, truth, s); }
+void Le_class::refine_range(RangeState &s, bool truth) { refine_comparison(e1, "<=", e2, truth, s); }
+void Equ_class::refine_range(RangeState &s, bool truth) { refine_comparison(e1, "==", e2, truth, s); }
+void Neq_class::refine_range(RangeState &s, bool truth) { refine_comparison(e1, "!=", e2, truth, s); }
+void Ge_class::refine_range(RangeState &s, bool truth) { refine_comparison(e1, ">=", e2, truth, s); }
+void Gt_class::refine_range(RangeState &s, bool truth) { refine_comparison(e1, ">", e2, truth, s); }
+
+// where a && b holds both did, where a || b fails both did
+void And_class::refine_range(RangeState &s, bool truth)
+{
+  if (truth) {
+    e1->refine_range(s, true);
+    e2->refine_range(s, true);
+  }
+}
+
+void Or_class::refine_range(RangeState &s, bool truth)
+{
+  if (!truth) {
+    e1->refine_range(s, false);
+    e2->refine_range(s, false);
+  }
+}
+
+void Not_class::refine_range(RangeState &s, bool truth) { e1->refine_range(s, !truth); }
+
+bool Object_class::is_variable(Symbol &name)
+{
+  name = var;
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////
+//
+//    temporaries
+//
+//    Sethi-Ullman labels: the number of stack temporaries live at
+//    once while the expression is coded, when the operands of each
+//    operator are coded heavier first (see code_operands in
+//    cgen.cc). Variables are read in place and need none.
+//
+//////////////////////////////////////////////////////////////////
+
+static int label(Expr e1, Expr e2)
+{
+  int n1 = e1->temporaries(), n2 = e2->temporaries();
+  return n1 == n2 ? n1 + 1 : std::max(n1, n2);
+}
+
+int Add_class::temporaries() { return label(e1, e2); }
+int Minus_class::temporaries() { return label(e1, e2); }
+int Multi_class::temporaries() { return label(e1, e2); }
+int Divide_class::temporaries() { return label(e1, e2); }
+int Mod_class::temporaries() { return label(e1, e2); }
+int Lt_class::temporaries() { return label(e1, e2); }
+int Le_class::temporaries() { return label(e1, e2); }
+int Equ_class::temporaries() { return label(e1, e2); }
+int Neq_class::temporaries() { return label(e1, e2); }
+int Ge_class::temporaries() { return label(e1, e2); }
+int Gt_class::temporaries() { return label(e1, e2); }
+int And_class::temporaries() { return label(e1, e2); }
+int Or_class::temporaries() { return label(e1, e2); }
+int Xor_class::temporaries() { return label(e1, e2); }
+int Bitand_class::temporaries() { return label(e1, e2); }
+int Bitor_class::temporaries() { return label(e1, e2); }
+int Neg_class::temporaries() { return std::max(e1->temporaries(), 1); }
+int Not_class::temporaries() { return std::max(e1->temporaries(), 1); }
+int Bitnot_class::temporaries() { return std::max(e1->temporaries(), 1); }
+int Object_class::temporaries() { return 0; }
+
+//////////////////////////////////////////////////////////////////
+//
+//    branch_probability / then_probability
+//
+//    static estimates of how often a condition holds, after Ball
+//    and Larus: equality and negative values are unlikely, and an
+//    arm that returns or leaves its loop is the unlikely one.  The
+//    heuristics that apply are combined as independent evidence.
+//
+//////////////////////////////////////////////////////////////////
+
+// the probabilities a heuristic gives the unlikely side
+#define OPCODE_PROBABILITY 0.25
+#define RETURN_PROBABILITY 0.28
+#define LOOP_EXIT_PROBABILITY 0.2
+
+static double combine_evidence(double p, double q)
+{
+  return p * q / (p * q + (1 - p) * (1 - q));
+}
+
+// equality with a constant is unlikely, and so is a value below zero
+static double comparison_probability(Expr e1, string op, Expr e2)
+{
+  long long value;
+  if (e1->is_const_int(value)) {
+    std::swap(e1, e2);
+    op = swap_relation(op);
+  }
+  if (!e2->is_const_int(value)) {
+    return 0.5;
+  }
+  if (op == "==") return OPCODE_PROBABILITY;
+  if (op == "!=") return 1 - OPCODE_PROBABILITY;
+  if (value == 0 && (op == "<" || op == "<=")) return OPCODE_PROBABILITY;
+  if (value == 0 && (op == ">" || op == ">=")) return 1 - OPCODE_PROBABILITY;
+  return 0.5;
+}
+
+double Lt_class::branch_probability() { return comparison_probability(e1, "<", e2); }
+double Le_class::branch_probability() { return comparison_probability(e1, "<=", e2); }
+double Equ_class::branch_probability() { return comparison_probability(e1, "==", e2); }
+double Neq_class::branch_probability() { return comparison_probability(e1, "!=", e2); }
+double Ge_class::branch_probability() { return comparison_probability(e1, ">=", e2); }
+double Gt_class::branch_probability() { return comparison_probability(e1, ">", e2); }
+
+double And_class::branch_probability() { return e1->branch_probability() * e2->branch_probability(); }
+double Or_class::branch_probability() { return 1 - (1 - e1->branch_probability()) * (1 - e2->branch_probability()); }
+double Not_class::branch_probability() { return 1 - e1->branch_probability(); }
+
+double IfStmt_class::then_probability()
+{
+  double p = condition->branch_probability();
+  if (thenexpr->isReturn() != elseexpr->isReturn()) {
+    p = combine_evidence(p, thenexpr->isReturn() ? RETURN_PROBABILITY : 1 - RETURN_PROBABILITY);
+  }
+  if (thenexpr->isBreak() != elseexpr->isBreak()) {
+    p = combine_evidence(p, thenexpr->isBreak() ? LOOP_EXIT_PROBABILITY : 1 - LOOP_EXIT_PROBABILITY);
+  }
+  return p;
+}
@@ -0,0 +1,676 @@
+//**************************************************************
+//
+// Instruction scheduling on the emitted assembly, run on every
+// function when the compiler is invoked with -O.
+//
+// A function's code is cut into basic blocks at labels, directives
+// and any instruction the scheduler does not model (calls, jumps,
+// pushes, ...).  Inside a block, registers whose value dies in the
+// block are renamed to registers the function does not use, so that
+// the reuse of %rbx or %xmm4 by every expression does not serialize
+// them, and the block is then list scheduled by critical path over
+// its register, %rbp slot and flags dependencies, with latencies and
+// execution units after Agner Fog's tables for recent Intel and AMD
+// cores.
+//
+//**************************************************************
+
+#include "cgen.h"
+#include <sstream>
+#include <algorithm>
+#include <set>
+
+using namespace std;
+
+extern int cgen_debug;
+
+// instructions that may start in one cycle
+#define ISSUE_WIDTH 4
+
+// extra latency of an operand read from memory (an L1 hit)
+#define LOAD_LATENCY 4
+
+enum OpKind {
+  OP_MOVE,       // dst = src
+  OP_ALU2,       // dst = dst op src, sets the flags
+  OP_FP2,        // dst = dst op src
+  OP_ALU1,       // dst = op dst, sets the flags
+  OP_COMPARE,    // reads both operands, sets the flags
+  OP_SETCC,      // low byte of dst = flags
+  OP_CMOVCC,     // dst = flags ? src : dst
+  OP_SIGN,       // %rdx = sign of %rax
+  OP_DIVIDE,     // %rax, %rdx = %rdx:%rax / src
+  OP_VEX3,       // dst = src1 op src2
+  OP_FMA         // dst = src1 * src2 op dst
+};
+
+enum Unit { UNIT_ALU, UNIT_MUL, UNIT_DIVIDER, UNIT_FADD, UNIT_FMUL, UNIT_LOAD, UNIT_STORE, UNITS };
+
+// how many of each unit there are
+static const int unit_count[UNITS] = { 4, 1, 1, 2, 2, 2, 1 };
+
+struct OpInfo {
+  const char *name;
+  OpKind kind;
+  int latency;
+  Unit unit;
+  int busy;         // cycles the unit is blocked for
+};
+
+static const OpInfo op_table[] = {
+  // name         kind         lat unit           busy
+  {"movq",        OP_MOVE,     1,  UNIT_ALU,      1},
+  {"movl",        OP_MOVE,     1,  UNIT_ALU,      1},
+  {"movsd",       OP_MOVE,     1,  UNIT_FADD,     1},
+  {"movaps",      OP_MOVE,     1,  UNIT_FADD,     1},
+  {"movzbq",      OP_MOVE,     1,  UNIT_ALU,      1},
+  {"cvtsi2sdq",   OP_MOVE,     4,  UNIT_FADD,     1},
+  {"cvttsd2siq",  OP_MOVE,     6,  UNIT_FADD,     1},
+  {"addq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"subq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"andq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"orq",         OP_ALU2,     1,  UNIT_ALU,      1},
+  {"xorq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"xorl",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"shrq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"sarq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"salq",        OP_ALU2,     1,  UNIT_ALU,      1},
+  {"imulq",       OP_ALU2,     3,  UNIT_MUL,      1},
+  {"negq",        OP_ALU1,     1,  UNIT_ALU,      1},
+  {"notq",        OP_ALU1,     1,  UNIT_ALU,      1},
+  {"addsd",       OP_FP2,      4,  UNIT_FADD,     1},
+  {"subsd",       OP_FP2,      4,  UNIT_FADD,     1},
+  {"mulsd",       OP_FP2,      4,  UNIT_FMUL,     1},
+  {"divsd",       OP_FP2,      14, UNIT_DIVIDER,  4},
+  {"xorpd",       OP_FP2,      1,  UNIT_FADD,     1},
+  {"cmpq",        OP_COMPARE,  1,  UNIT_ALU,      1},
+  {"testq",       OP_COMPARE,  1,  UNIT_ALU,      1},
+  {"ucomisd",     OP_COMPARE,  3,  UNIT_FADD,     1},
+  {"sete",        OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setne",       OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setl",        OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setle",       OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setg",        OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setge",       OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setb",        OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setbe",       OP_SETCC,    1,  UNIT_ALU,      1},
+  {"seta",        OP_SETCC,    1,  UNIT_ALU,      1},
+  {"setae",       OP_SETCC,    1,  UNIT_ALU,      1},
+  {"cmovnz",      OP_CMOVCC,   1,  UNIT_ALU,      1},
+  {"cmovz",       OP_CMOVCC,   1,  UNIT_ALU,      1},
+  {"cqto",        OP_SIGN,     1,  UNIT_ALU,      1},
+  {"idivq",       OP_DIVIDE,   42, UNIT_DIVIDER,  24},
+  {"divl",        OP_DIVIDE,   26, UNIT_DIVIDER,  6},
+  {"vmovsd",      OP_MOVE,     1,  UNIT_FADD,     1},
+  {"vaddsd",      OP_VEX3,     4,  UNIT_FADD,     1},
+  {"vsubsd",      OP_VEX3,     4,  UNIT_FADD,     1},
+  {"vmulsd",      OP_VEX3,     4,  UNIT_FMUL,     1},
+  {"vdivsd",      OP_VEX3,     14, UNIT_DIVIDER,  4},
+  {"vcvtsi2sdq",  OP_VEX3,     4,  UNIT_FADD,     1},
+  {"vfmadd231sd", OP_FMA,      4,  UNIT_FMUL,     1},
+  {"vfmsub231sd", OP_FMA,      4,  UNIT_FMUL,     1},
+  {"vfnmadd231sd", OP_FMA,     4,  UNIT_FMUL,     1},
+};
+
+static const OpInfo *find_op(const string &name)
+{
+  for (size_t i = 0; i < sizeof(op_table) / sizeof(op_table[0]); i++) {
+    if (name == op_table[i].name) {
+      return &op_table[i];
+    }
+  }
+  return NULL;
+}
+
+// the 64-bit register a register name is part of ("%eax" -> "%rax"),
+// or "" if it is none
+static string full_register(const string &name)
+{
+  static const char *gp[][4] = {
+    {"%rax", "%eax", "%ax", "%al"}, {"%rbx", "%ebx", "%bx", "%bl"},
+    {"%rcx", "%ecx", "%cx", "%cl"}, {"%rdx", "%edx", "%dx", "%dl"},
+    {"%rsi", "%esi", "%si", "%sil"}, {"%rdi", "%edi", "%di", "%dil"},
+  };
+  for (size_t i = 0; i < sizeof(gp) / sizeof(gp[0]); i++) {
+    for (int j = 0; j < 4; j++) {
+      if (name == gp[i][j]) return gp[i][0];
+    }
+  }
+  if (name.compare(0, 2, "%r") == 0 && name.size() > 2 && isdigit((unsigned char)name[2])) {
+    size_t end = 2;
+    while (end < name.size() && isdigit((unsigned char)name[end])) end++;
+    return name.substr(0, end);
+  }
+  if (name.compare(0, 4, "%xmm") == 0) {
+    return name;
+  }
+  return "";
+}
+
+static bool is_xmm(const string &reg) { return reg.compare(0, 4, "%xmm") == 0; }
+
+// an operand that is a whole register, by the name it is renamed by
+static bool whole_register(const string &operand)
+{
+  return operand[0] == '%' && full_register(operand) == operand;
+}
+
+struct Insn {
+  string text;
+  string op;
+  vector<string> operands;
+  const OpInfo *info;           // NULL for a barrier
+  set<string> reads, writes;    // whole registers, and "flags"
+  set<string> implicit;         // registers used without being named
+  bool mem_read, mem_write;
+  string mem_base;              // "%rbp" or a symbol
+  long mem_disp;
+};
+
+static string trim(const string &s)
+{
+  size_t b = s.find_first_not_of(" \t");
+  size_t e = s.find_last_not_of(" \t");
+  return b == string::npos ? "" : s.substr(b, e - b + 1);
+}
+
+// splits "disp(%base)" or "sym(%rip)"; false for anything else
+static bool memory_operand(const string &operand, string &base, long &disp)
+{
+  size_t open = operand.find('(');
+  if (open == string::npos || operand[operand.size() - 1] != ')') {
+    return false;
+  }
+  string reg = operand.substr(open + 1, operand.size() - open - 2);
+  string prefix = operand.substr(0, open);
+  if (reg == "%rbp") {
+    char *end;
+    disp = prefix.empty() ? 0 : strtol(prefix.c_str(), &end, 10);
+    base = reg;
+    return prefix.empty() || *end == '\0';
+  }
+  if (reg == "%rip") {
+    base = prefix;
+    disp = 0;
+    return true;
+  }
+  return false;
+}
+
+static void read_operand(Insn &insn, const string &operand)
+{
+  if (operand[0] == '%') {
+    insn.reads.insert(full_register(operand));
+  } else if (operand[0] != '$') {
+    insn.mem_read = true;
+  }
+}
+
+static void write_operand(Insn &insn, const string &operand)
+{
+  if (operand[0] == '%') {
+    // a part of a register is merged into the rest of it, except
+    // that 32-bit writes clear the upper half
+    string reg = full_register(operand);
+    if (reg != operand && operand[0] == '%' && operand[1] != 'e' && !is_xmm(reg)) {
+      insn.reads.insert(reg);
+    }
+    insn.writes.insert(reg);
+  } else {
+    insn.mem_write = true;
+  }
+}
+
+static size_t operand_count(OpKind kind)
+{
+  switch (kind) {
+  case OP_SIGN: return 0;
+  case OP_ALU1: case OP_SETCC: case OP_DIVIDE: return 1;
+  case OP_VEX3: case OP_FMA: return 3;
+  default: return 2;
+  }
+}
+
+static Insn parse_insn(const string &line)
+{
+  Insn insn;
+  insn.text = line;
+  insn.info = NULL;
+  insn.mem_read = insn.mem_write = false;
+  insn.mem_disp = 0;
+  if (line.size() < 2 || line[0] != '\t' || !isalpha((unsigned char)line[1])) {
+    return insn;
+  }
+
+  string body = trim(line);
+  size_t space = body.find_first_of(" \t");
+  insn.op = body.substr(0, space);
+  if (space != string::npos) {
+    string rest = body.substr(space);
+    int depth = 0;
+    string operand;
+    for (size_t i = 0; i < rest.size(); i++) {
+      if (rest[i] == '(') depth++;
+      if (rest[i] == ')') depth--;
+      if (rest[i] == ',' && depth == 0) {
+        insn.operands.push_back(trim(operand));
+        operand.clear();
+      } else {
+        operand += rest[i];
+      }
+    }
+    insn.operands.push_back(trim(operand));
+  }
+
+  const OpInfo *info = find_op(insn.op);
+  if (info == NULL) {
+    return insn;
+  }
+  size_t n = insn.operands.size();
+  if (n != operand_count(info->kind)) {
+    return insn;
+  }
+
+  // %rsp only moves in barriers, and memory other than the frame and
+  // named data is not modelled
+  int memory = 0;
+  for (size_t i = 0; i < n; i++) {
+    const string &operand = insn.operands[i];
+    if (operand.find("%rsp") != string::npos) {
+      return insn;
+    }
+    if (operand[0] == '%' && full_register(operand) == "") {
+      return insn;
+    }
+    if (operand[0] != '%' && operand[0] != '$') {
+      if (!memory_operand(operand, insn.mem_base, insn.mem_disp)) {
+        return insn;
+      }
+      memory++;
+    }
+  }
+  if (memory > 1) {
+    return insn;
+  }
+
+  switch (info->kind) {
+  case OP_MOVE:
+    read_operand(insn, insn.operands[0]);
+    // a register to register movsd only replaces the low half
+    if (insn.op == "movsd" && insn.operands[0][0] == '%' && insn.operands[1][0] == '%') {
+      read_operand(insn, insn.operands[1]);
+    }
+    write_operand(insn, insn.operands[1]);
+    break;
+  case OP_ALU2:
+  case OP_FP2:
+  case OP_CMOVCC:
+    read_operand(insn, insn.operands[0]);
+    read_operand(insn, insn.operands[1]);
+    write_operand(insn, insn.operands[1]);
+    if (info->kind == OP_ALU2) insn.writes.insert("flags");
+    if (info->kind == OP_CMOVCC) insn.reads.insert("flags");
+    break;
+  case OP_ALU1:
+    read_operand(insn, insn.operands[0]);
+    write_operand(insn, insn.operands[0]);
+    insn.writes.insert("flags");
+    break;
+  case OP_COMPARE:
+    read_operand(insn, insn.operands[0]);
+    read_operand(insn, insn.operands[1]);
+    insn.writes.insert("flags");
+    break;
+  case OP_SETCC:
+    insn.reads.insert("flags");
+    write_operand(insn, insn.operands[0]);
+    break;
+  case OP_SIGN:
+    insn.reads.insert("%rax");
+    insn.writes.insert("%rdx");
+    insn.implicit.insert("%rax");
+    insn.implicit.insert("%rdx");
+    break;
+  case OP_DIVIDE:
+    read_operand(insn, insn.operands[0]);
+    insn.reads.insert("%rax");
+    insn.reads.insert("%rdx");
+    insn.writes.insert("%rax");
+    insn.writes.insert("%rdx");
+    insn.writes.insert("flags");
+    insn.implicit.insert("%rax");
+    insn.implicit.insert("%rdx");
+    break;
+  case OP_VEX3:
+    read_operand(insn, insn.operands[0]);
+    read_operand(insn, insn.operands[1]);
+    write_operand(insn, insn.operands[2]);
+    break;
+  case OP_FMA:
+    read_operand(insn, insn.operands[0]);
+    read_operand(insn, insn.operands[1]);
+    read_operand(insn, insn.operands[2]);
+    write_operand(insn, insn.operands[2]);
+    break;
+  }
+  if (insn.mem_read && insn.operands[n - 1][0] != '%' && (info->kind == OP_ALU2 || info->kind == OP_FP2 || info->kind == OP_ALU1)) {
+    insn.mem_write = true;
+  }
+  insn.info = info;
+  return insn;
+}
+
+// the register the instruction sets without reading, or ""
+static string defined_register(const Insn &insn)
+{
+  if (insn.info == NULL || (insn.info->kind != OP_MOVE && insn.info->kind != OP_VEX3)) {
+    return "";
+  }
+  const string &dst = insn.operands.back();
+  if (!whole_register(dst) || insn.reads.count(dst)) {
+    return "";
+  }
+  return dst;
+}
+
+// whether every use of reg in the instruction is by its whole name
+static bool renamable_in(const Insn &insn, const string &reg)
+{
+  if (insn.implicit.count(reg)) {
+    return false;
+  }
+  for (size_t i = 0; i < insn.operands.size(); i++) {
+    const string &operand = insn.operands[i];
+    if (operand[0] == '%' && full_register(operand) == reg && operand != reg) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool mentions(const Insn &insn, const string &reg)
+{
+  return insn.reads.count(reg) || insn.writes.count(reg);
+}
+
+static void replace_register(Insn &insn, const string &from, const string &to)
+{
+  string text = "\t" + insn.op + "\t";
+  for (size_t i = 0; i < insn.operands.size(); i++) {
+    if (insn.operands[i] == from) {
+      insn.operands[i] = to;
+    }
+    text += (i ? ", " : "") + insn.operands[i];
+  }
+  insn.text = text;
+  if (insn.reads.erase(from)) insn.reads.insert(to);
+  if (insn.writes.erase(from)) insn.writes.insert(to);
+}
+
+//
+// Gives each value that is set and dies inside the block a register
+// of its own from spare (registers the function never names), so
+// that only true dependencies are left between its instructions.
+//
+static void rename_registers(vector<Insn> &block, const vector<string> &spare)
+{
+  map<string, size_t> busy_until;
+  for (size_t i = 0; i < block.size(); i++) {
+    string reg = defined_register(block[i]);
+    if (reg == "") {
+      continue;
+    }
+    size_t kill = 0;
+    for (size_t k = i + 1; k < block.size() && block[k].info != NULL; k++) {
+      if (!mentions(block[k], reg)) {
+        continue;
+      }
+      if (!renamable_in(block[k], reg)) {
+        break;
+      }
+      if (defined_register(block[k]) == reg) {
+        kill = k;
+        break;
+      }
+    }
+    if (kill == 0) {
+      continue;
+    }
+    // the register free for longest, to leave the fewest false
+    // dependencies between the renamed values
+    int best = -1;
+    for (size_t p = 0; p < spare.size(); p++) {
+      if (is_xmm(spare[p]) == is_xmm(reg) && busy_until[spare[p]] <= i &&
+          (best < 0 || busy_until[spare[p]] < busy_until[spare[best]])) {
+        best = p;
+      }
+    }
+    if (best >= 0) {
+      for (size_t k = i; k < kill; k++) {
+        replace_register(block[k], reg, spare[best]);
+      }
+      busy_until[spare[best]] = kill;
+    }
+  }
+}
+
+struct Edge {
+  size_t to;
+  int latency;
+};
+
+static int result_latency(const Insn &insn)
+{
+  return insn.info->latency + (insn.mem_read ? LOAD_LATENCY : 0);
+}
+
+static bool memory_conflict(const Insn &a, const Insn &b)
+{
+  if (!(a.mem_write || b.mem_write) || !(a.mem_read || a.mem_write) || !(b.mem_read || b.mem_write)) {
+    return false;
+  }
+  if (a.mem_base != b.mem_base) {
+    return false;
+  }
+  return a.mem_disp < b.mem_disp + 8 && b.mem_disp < a.mem_disp + 8;
+}
+
+//
+// The dependencies between the n scheduled instructions of the
+// block; the terminator, if any, is block[n] and stays last.
+//
+static vector<vector<Edge> > build_dependencies(const vector<Insn> &block, size_t n)
+{
+  vector<vector<Edge> > succ(n);
+  for (size_t j = 0; j < n; j++) {
+    const Insn &b = block[j];
+    for (size_t i = 0; i < j; i++) {
+      const Insn &a = block[i];
+      int latency = -1;
+      for (set<string>::const_iterator r = b.reads.begin(); r != b.reads.end(); ++r) {
+        if (*r != "flags" && a.writes.count(*r)) latency = max(latency, result_latency(a));
+      }
+      for (set<string>::const_iterator w = b.writes.begin(); w != b.writes.end(); ++w) {
+        if (*w != "flags" && (a.reads.count(*w) || a.writes.count(*w))) latency = max(latency, 0);
+      }
+      if (memory_conflict(a, b)) {
+        latency = max(latency, a.mem_write && b.mem_read ? 1 : 0);
+      }
+      if (latency >= 0) {
+        succ[i].push_back((Edge){j, latency});
+      }
+    }
+  }
+
+  // a reader of the flags stays after the instruction that set them
+  // for it, and every other setter before that one or after the reader
+  for (size_t r = 0; r <= n && r < block.size(); r++) {
+    if (!block[r].reads.count("flags") && !(r == n && block[r].op[0] == 'j' && block[r].op != "jmp")) {
+      continue;
+    }
+    size_t setter = r;
+    for (size_t i = r; i-- > 0; ) {
+      if (block[i].writes.count("flags")) {
+        setter = i;
+        break;
+      }
+    }
+    if (setter == r) {
+      continue;
+    }
+    if (r < n) {
+      succ[setter].push_back((Edge){r, result_latency(block[setter])});
+    }
+    for (size_t w = 0; w < n; w++) {
+      if (w == setter || w == r || !block[w].writes.count("flags")) {
+        continue;
+      }
+      if (w < setter) {
+        succ[w].push_back((Edge){setter, 0});
+      } else if (r < n) {
+        succ[r].push_back((Edge){w, 0});
+      }
+    }
+  }
+  return succ;
+}
+
+//
+// Cycle by cycle list scheduling: of the instructions whose operands
+// are ready, the one with the longest path to the end of the block
+// goes first, as far as issue width and free units allow.  With
+// in_order set the original order is kept, to estimate what the
+// schedule gained.  Returns the estimated cycles of the block.
+//
+static int list_schedule(const vector<Insn> &block, size_t n, const vector<vector<Edge> > &succ,
+                         vector<size_t> &order, bool in_order)
+{
+  vector<int> height(n, 0), ready_at(n, 0), preds(n, 0);
+  for (size_t i = n; i-- > 0; ) {
+    height[i] = result_latency(block[i]);
+    for (size_t e = 0; e < succ[i].size(); e++) {
+      height[i] = max(height[i], succ[i][e].latency + height[succ[i][e].to]);
+      preds[succ[i][e].to]++;
+    }
+  }
+
+  vector<vector<int> > free_at(UNITS);
+  for (int u = 0; u < UNITS; u++) {
+    free_at[u].assign(unit_count[u], 0);
+  }
+
+  order.clear();
+  vector<bool> done(n, false);
+  int cycle = 0, finish = 0;
+  while (order.size() < n) {
+    vector<size_t> ready;
+    for (size_t i = 0; i < n; i++) {
+      if (!done[i] && preds[i] == 0 && ready_at[i] <= cycle) {
+        ready.push_back(i);
+      }
+    }
+    if (in_order) {
+      ready.erase(std::remove_if(ready.begin(), ready.end(),
+                                 [&](size_t i) { return i != order.size(); }), ready.end());
+    } else {
+      std::stable_sort(ready.begin(), ready.end(),
+                       [&](size_t a, size_t b) { return height[a] > height[b]; });
+    }
+
+    int issued = 0;
+    for (size_t k = 0; k < ready.size() && issued < ISSUE_WIDTH; k++) {
+      const Insn &insn = block[ready[k]];
+      vector<int> units(1, insn.info->unit);
+      if (insn.mem_read) units.push_back(UNIT_LOAD);
+      if (insn.mem_write) units.push_back(UNIT_STORE);
+      // a plain load or store needs no execution unit
+      if (insn.info->kind == OP_MOVE && (insn.mem_read || insn.mem_write)) units.erase(units.begin());
+      vector<int *> slots;
+      for (size_t u = 0; u < units.size(); u++) {
+        vector<int> &instances = free_at[units[u]];
+        int *slot = &*std::min_element(instances.begin(), instances.end());
+        if (*slot > cycle) break;
+        slots.push_back(slot);
+      }
+      if (slots.size() < units.size()) {
+        continue;
+      }
+      for (size_t u = 0; u < slots.size(); u++) {
+        *slots[u] = cycle + (units[u] == insn.info->unit ? insn.info->busy : 1);
+      }
+
+      size_t i = ready[k];
+      done[i] = true;
+      order.push_back(i);
+      issued++;
+      finish = max(finish, cycle + result_latency(insn));
+      for (size_t e = 0; e < succ[i].size(); e++) {
+        Edge edge = succ[i][e];
+        ready_at[edge.to] = max(ready_at[edge.to], cycle + edge.latency);
+        preds[edge.to]--;
+      }
+    }
+    cycle++;
+  }
+  return max(finish, cycle);
+}
+
+//
+// Schedules the code of one function, see the top of the file.
+//
+string schedule_code(const string &text, Symbol name)
+{
+  // the registers the function never names are free for renaming
+  static const char *candidates[] = {
+    "%r11", "%r10", "%r9", "%r8", "%rsi", "%rdi", "%rcx", "%r12", "%r13", "%r14", "%r15",
+    "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+    "%xmm8", "%xmm9", "%xmm10", "%xmm11", "%xmm12", "%xmm13", "%xmm14", "%xmm15",
+  };
+  vector<string> lines;
+  set<string> named;
+  std::istringstream in(text);
+  string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line);
+    for (size_t i = line.find('%'); i != string::npos; i = line.find('%', i + 1)) {
+      size_t end = i + 1;
+      while (end < line.size() && isalnum((unsigned char)line[end])) end++;
+      named.insert(full_register(line.substr(i, end - i)));
+    }
+  }
+  vector<string> spare;
+  for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++) {
+    if (!named.count(candidates[i])) {
+      spare.push_back(candidates[i]);
+    }
+  }
+
+  string result;
+  int before = 0, after = 0;
+  vector<Insn> block;
+  for (size_t l = 0; l <= lines.size(); l++) {
+    Insn insn = l < lines.size() ? parse_insn(lines[l]) : parse_insn("");
+    if (insn.info != NULL) {
+      block.push_back(insn);
+      continue;
+    }
+    // a barrier ends the block and is kept after it
+    size_t n = block.size();
+    block.push_back(insn);
+    rename_registers(block, spare);
+    vector<vector<Edge> > succ = build_dependencies(block, n);
+    vector<size_t> order;
+    before += list_schedule(block, n, succ, order, true);
+    after += list_schedule(block, n, succ, order, false);
+    for (size_t i = 0; i < order.size(); i++) {
+      result += block[order[i]].text + "\n";
+    }
+    if (l < lines.size()) {
+      result += lines[l] + "\n";
+    }
+    block.clear();
+  }
+
+  if (cgen_debug) cout << "Scheduling " << name << ", estimated " << before << " cycles to " << after << endl;
+  return result;
+}
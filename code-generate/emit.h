@@ -41,6 +41,7 @@
 #define OBJECT                  "@object"
 #define FUNCTION                "@function"
 #define SIZE                    "\t.size\t"
+#define SET                     "\t.set\t"
 
 // Prefixs
 #define STRINGCONST_PREFIX      ".LC"
@@ -74,6 +75,14 @@
 #define XMM5    "%xmm5"     // float register
 #define XMM6    "%xmm6"     // float register
 #define XMM7    "%xmm7"     // float register
+#define XMM8    "%xmm8"    // float register
+#define XMM9    "%xmm9"    // float register
+#define XMM10   "%xmm10"    // float register
+#define XMM11   "%xmm11"    // float register
+#define XMM12   "%xmm12"    // float register
+#define XMM13   "%xmm13"    // float register
+#define XMM14   "%xmm14"    // float register
+#define XMM15   "%xmm15"    // float register
 
 //
 // Opcodes
@@ -91,6 +100,9 @@
 #define SUB     "\tsubq\t"     
 #define DIV     "\tidivq\t"
 #define CQTO    "\tcqto\t"
+#define DIVL    "\tdivl\t"
+#define SHR     "\tshrq\t"
+#define XORL    "\txorl\t"
 #define MUL     "\timulq\t"
 #define AND     "\tandq\t"
 #define OR      "\torq\t"
@@ -107,6 +119,14 @@
 #define TEST    "\ttestq\t"
 #define JZ      "\tjz\t"
 #define JNZ     "\tjnz\t"
+#define SETL    "\tsetl\t"
+#define SETLE   "\tsetle\t"
+#define SETE    "\tsete\t"
+#define SETNE   "\tsetne\t"
+#define SETG    "\tsetg\t"
+#define SETGE   "\tsetge\t"
+#define MOVZBQ  "\tmovzbq\t"
+#define CMOVNZ  "\tcmovnz\t"
 // float
 #define MOVSD   "\tmovsd\t" 
 
@@ -121,6 +141,10 @@
 #define JBE     "\tjbe\t"
 #define JA      "\tja\t"
 #define JAE     "\tjae\t"
+#define SETB    "\tsetb\t"
+#define SETBE   "\tsetbe\t"
+#define SETA    "\tseta\t"
+#define SETAE   "\tsetae\t"
 #define JP      "\tjp\t"
 #define JP      "\tjp\t"
 
@@ -131,6 +155,20 @@
 // convert xmm to xmm
 #define MOVAPS "\tmovaps\t"
 
+// VEX encodings (-march=x86-64-v3), three operands: src2, src1, dest
+#define VMOVSD   "\tvmovsd\t"
+#define VADDSD   "\tvaddsd\t"
+#define VSUBSD   "\tvsubsd\t"
+#define VMULSD   "\tvmulsd\t"
+#define VDIVSD   "\tvdivsd\t"
+#define VCVTSI2SDQ "\tvcvtsi2sdq\t"
+#define VFMADD231SD  "\tvfmadd231sd\t"    // dest = src1 * src2 + dest
+#define VFMSUB231SD  "\tvfmsub231sd\t"    // dest = src1 * src2 - dest
+#define VFNMADD231SD "\tvfnmadd231sd\t"   // dest = dest - src1 * src2
+
 // printf
 #define MOVL     "\tmovl\t" 
-#define EAX     "%eax"      // 32 bit general purpose register
\ No newline at end of file
+#define EAX     "%eax"      // 32 bit general purpose register
+#define AL      "%al"       // low byte of rax
+#define EBX     "%ebx"
+#define EDX     "%edx"
@@ -6,8 +6,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "seal-io.h"
 #include <unistd.h>
+#include <cpuid.h>
 #include "cgen_gc.h"
 
 //
@@ -30,6 +32,12 @@ extern int seal_yydebug;        // for the parser
        bool disable_reg_alloc;  // Don't do register allocation
 
        int cgen_optimize;       // optimize switch for code generator 
+       int cgen_whole_program;  // only main is called from outside
+       int cgen_function_sections; // each function in a section of its own
+       int cgen_single_pass;    // check and code each function in one walk
+       int cgen_avx;            // VEX encoded scalar float instructions
+       int cgen_fma;            // fused multiply-add instructions
+       int cgen_fp_contract;    // a * b + c may be fused into one rounding
        char *out_filename;      // file name for generated code
        Memmgr cgen_Memmgr = GC_NOGC;      // enable/disable garbage collection
        Memmgr_Test cgen_Memmgr_Test = GC_NORMAL;  // normal/test GC
@@ -39,6 +47,40 @@ extern int seal_yydebug;        // for the parser
 extern int optind, opterr;
 extern char *optarg;
 
+// -march=native: AVX if the OS saves the ymm state, and FMA with it
+static void detect_native_arch()
+{
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) {
+    return;
+  }
+  unsigned int xcr0, xcr0_high;
+  __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0_high) : "c"(0));
+  if ((xcr0 & 6) != 6) {
+    return;
+  }
+  cgen_avx = 1;
+  cgen_fma = (ecx & bit_FMA) != 0;
+}
+
+// x86-64 is plain SSE2; x86-64-v3 adds AVX, AVX2 and FMA among others
+static bool set_arch(const char *arch)
+{
+  cgen_avx = cgen_fma = 0;
+  if (strcmp(arch, "x86-64") == 0) {
+    return true;
+  }
+  if (strcmp(arch, "x86-64-v3") == 0) {
+    cgen_avx = cgen_fma = 1;
+    return true;
+  }
+  if (strcmp(arch, "native") == 0) {
+    detect_native_arch();
+    return true;
+  }
+  return false;
+}
+
 void handle_flags(int argc, char *argv[]) {
   int c;
   int unknownopt = 0;
@@ -50,10 +92,16 @@ void handle_flags(int argc, char *argv[]) {
   semant_debug = 0;
   cgen_debug = 0;
   cgen_optimize = 0;
+  cgen_whole_program = 0;
+  cgen_function_sections = 0;
+  cgen_single_pass = 0;
+  cgen_avx = 0;
+  cgen_fma = 0;
+  cgen_fp_contract = 0;
   disable_reg_alloc = 0;
   
 
-  while ((c = getopt(argc, argv, "lpscvrOo:gtT")) != -1) {
+  while ((c = getopt(argc, argv, "lpscvrOo:gtTf:m:")) != -1) {
     switch (c) {
 #ifdef DEBUG
     case 'l':
@@ -99,6 +147,30 @@ void handle_flags(int argc, char *argv[]) {
     case 'O':  // enable optimization
       cgen_optimize = 1;
       break;
+    case 'f':  // -fwhole-program: optimize, calling convention of our own
+               // -ffunction-sections: .text.hot.<name> etc., with -O
+               // -ffp-contract=fast|on|off: fuse a * b + c, with FMA
+               // -fsingle-pass: check and code each function at once, without -O
+      if (strcmp(optarg, "whole-program") == 0) {
+        cgen_optimize = 1;
+        cgen_whole_program = 1;
+      } else if (strcmp(optarg, "function-sections") == 0) {
+        cgen_function_sections = 1;
+      } else if (strcmp(optarg, "single-pass") == 0) {
+        cgen_single_pass = 1;
+      } else if (strcmp(optarg, "fp-contract=fast") == 0 || strcmp(optarg, "fp-contract=on") == 0) {
+        cgen_fp_contract = 1;
+      } else if (strcmp(optarg, "fp-contract=off") == 0) {
+        cgen_fp_contract = 0;
+      } else {
+        unknownopt = 1;
+      }
+      break;
+    case 'm':  // -march=x86-64|x86-64-v3|native: the instructions to use
+      if (strncmp(optarg, "arch=", 5) != 0 || !set_arch(optarg + 5)) {
+        unknownopt = 1;
+      }
+      break;
     case '?':
       unknownopt = 1;
       break;
@@ -111,11 +183,16 @@ void handle_flags(int argc, char *argv[]) {
   if (unknownopt) {
       cerr << "usage: " << argv[0] << 
 #ifdef DEBUG
-	  " [-lvpscOgtTr -o outname] [input-files]\n";
+	  " [-lvpscOgtTr -fwhole-program -ffunction-sections -fsingle-pass -ffp-contract=... -march=... -o outname] [input-files]\n";
 #else
-      " [-OgtT -o outname] [input-files]\n";
+      " [-OgtT -fwhole-program -ffunction-sections -fsingle-pass -ffp-contract=... -march=... -o outname] [input-files]\n";
 #endif
       exit(1);
   }
 
+  // -O needs the whole program before it codes any function
+  if (cgen_single_pass && cgen_optimize) {
+      cerr << "warning: -fsingle-pass is ignored with -O and -fwhole-program\n";
+      cgen_single_pass = 0;
+  }
 }
@@ -1,20 +1,40 @@
 #!/bin/bash
 cd test
 for filename in *.seal; do
-    echo "--------Test using" $filename "--------"
     name=${filename//.seal}
-    ../cgen $filename -o $name.s
-    gcc $name.s -o $name -no-pie
-    ./$name > tempfile
-    ../test-answer/$name > tempfile2
-    diff tempfile tempfile2 > /dev/null
-    if [ $? -eq 0 ] ; then
+    # test/<name>.flags lists the flag sets to run the test with, one per
+    # line (an empty line runs it without flags); the code of the first
+    # is kept as test/<name>.s
+    if [ -f $name.flags ]; then
+        mapfile -t flagsets < $name.flags
+    else
+        flagsets=("" "-O" "-fwhole-program" "-fsingle-pass")
+    fi
+    for i in "${!flagsets[@]}"; do
+        flags=${flagsets[$i]}
+        echo "--------Test using" $filename $flags "--------"
+        if [ $i -eq 0 ]; then asm=$name.s; else asm=$name-$i.s; fi
+        ../cgen $filename $flags -o $asm
+        gcc $asm -o $name -no-pie
+        ./$name > tempfile
+        ../test-answer/$name > tempfile2
+        diff tempfile tempfile2 > /dev/null
+        if [ $? -eq 0 ] ; then
+            echo passed
+        else
+            echo NOT passed
+        fi
+        rm -f $name
+        if [ $i -ne 0 ]; then rm -f $asm; fi
+    done
+    # -c checks that the flat tree codegen reads prints like the AST
+    echo "--------Test flat tree of" $filename "--------"
+    if ../cgen $filename ${flagsets[0]} -c -o /dev/null | grep -q "^Flat tree matches the AST"; then
         echo passed
     else
         echo NOT passed
     fi
-    rm -f $name
 done
 
 rm -f tempfile tempfile2
-cd ..
\ No newline at end of file
+cd ..
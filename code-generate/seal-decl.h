@@ -18,6 +18,10 @@ public:
     virtual Symbol getType() = 0;
     virtual void check() = 0;
     virtual void code(ostream&) = 0;
+    virtual void optimize() = 0;
+    virtual void plan_arguments() = 0;
+    virtual void resolve_variables() = 0;
+    virtual void flatten(FlatTree&) = 0;
 };
 
 
@@ -37,6 +41,7 @@ public:
    Variable copy_Variable();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int);
+   void flatten(FlatTree&);
 };
 
 class VariableDecl_class : public Decl_class {
@@ -55,6 +60,10 @@ public:
    bool isCallDecl(){return false;}
    void check();
    void code(ostream&){}
+   void optimize(){}
+   void plan_arguments(){}
+   void resolve_variables(){}
+   void flatten(FlatTree&);
 };
 
 class CallDecl_class : public Decl_class {
@@ -63,6 +72,7 @@ protected:
     Variables paras;
     Symbol   returnType;
     StmtBlock body;
+    int slot_count;     // frame slots of paras and locals, see resolve_variables
     
 public:
    CallDecl_class(Symbol a1, Variables a2, Symbol a3, StmtBlock a4) {
@@ -70,6 +80,7 @@ public:
       paras = a2;
       returnType = a3;
       body = a4;
+      slot_count = 0;
    }
 
    Symbol getName(){return name;}
@@ -83,6 +94,10 @@ public:
    bool isCallDecl(){return true;}
    void check();
    void code(ostream&);
+   void optimize();
+   void plan_arguments();
+   void resolve_variables();
+   void flatten(FlatTree&);
 };
 
 typedef class Decl_class *Decl;
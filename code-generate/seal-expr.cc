@@ -6,7 +6,7 @@
 
 Expr Assign_class::copy_Expr()
 {
-   return new Assign_class(copy_Symbol(lvalue), value->copy_Expr());
+   return (new Assign_class(copy_Symbol(lvalue), value->copy_Expr()))->setType(type);
 }
 
 
@@ -19,7 +19,7 @@ void Assign_class::dump(ostream& stream, int n)
 
 Expr Add_class::copy_Expr()
 {
-   return new Add_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Add_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -32,7 +32,7 @@ void Add_class::dump(ostream& stream, int n)
 
 Expr Minus_class::copy_Expr()
 {
-   return new Minus_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Minus_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -45,7 +45,7 @@ void Minus_class::dump(ostream& stream, int n)
 
 Expr Multi_class::copy_Expr()
 {
-   return new Multi_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Multi_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -58,7 +58,7 @@ void Multi_class::dump(ostream& stream, int n)
 
 Expr Divide_class::copy_Expr()
 {
-   return new Divide_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Divide_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -71,7 +71,7 @@ void Divide_class::dump(ostream& stream, int n)
 
 Expr Mod_class::copy_Expr()
 {
-   return new Mod_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Mod_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -85,7 +85,7 @@ void Mod_class::dump(ostream& stream, int n)
 
 Expr Neg_class::copy_Expr()
 {
-   return new Neg_class(e1->copy_Expr());
+   return (new Neg_class(e1->copy_Expr()))->setType(type);
 }
 
 
@@ -97,7 +97,7 @@ void Neg_class::dump(ostream& stream, int n)
 
 Expr Lt_class::copy_Expr()
 {
-   return new Lt_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Lt_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -110,7 +110,7 @@ void Lt_class::dump(ostream& stream, int n)
 
 Expr Le_class::copy_Expr()
 {
-   return new Le_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Le_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -123,7 +123,7 @@ void Le_class::dump(ostream& stream, int n)
 
 Expr Equ_class::copy_Expr()
 {
-   return new Equ_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Equ_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -136,7 +136,7 @@ void Equ_class::dump(ostream& stream, int n)
 
 Expr Neq_class::copy_Expr()
 {
-   return new Neq_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Neq_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -149,7 +149,7 @@ void Neq_class::dump(ostream& stream, int n)
 
 Expr Ge_class::copy_Expr()
 {
-   return new Ge_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Ge_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -162,7 +162,7 @@ void Ge_class::dump(ostream& stream, int n)
 
 Expr Gt_class::copy_Expr()
 {
-   return new Gt_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Gt_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -175,7 +175,7 @@ void Gt_class::dump(ostream& stream, int n)
 
 Expr And_class::copy_Expr()
 {
-   return new And_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new And_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -189,7 +189,7 @@ void And_class::dump(ostream& stream, int n)
 
 Expr Or_class::copy_Expr()
 {
-   return new Or_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Or_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -203,7 +203,7 @@ void Or_class::dump(ostream& stream, int n)
 
 Expr Xor_class::copy_Expr()
 {
-   return new Xor_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Xor_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -217,7 +217,7 @@ void Xor_class::dump(ostream& stream, int n)
 
 Expr Not_class::copy_Expr()
 {
-   return new Not_class(e1->copy_Expr());
+   return (new Not_class(e1->copy_Expr()))->setType(type);
 }
 
 
@@ -230,7 +230,7 @@ void Not_class::dump(ostream& stream, int n)
 
 Expr Bitnot_class::copy_Expr()
 {
-   return new Bitnot_class(e1->copy_Expr());
+   return (new Bitnot_class(e1->copy_Expr()))->setType(type);
 }
 
 
@@ -242,7 +242,7 @@ void Bitnot_class::dump(ostream& stream, int n)
 
 Expr Bitand_class::copy_Expr()
 {
-   return new Bitand_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Bitand_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -250,11 +250,12 @@ void Bitand_class::dump(ostream& stream, int n)
 {
    stream << pad(n) << "_bitand\n";
    e1->dump(stream, n+2);
+   e2->dump(stream, n+2);
 }
 
 Expr Bitor_class::copy_Expr()
 {
-   return new Bitor_class(e1->copy_Expr(), e2->copy_Expr());
+   return (new Bitor_class(e1->copy_Expr(), e2->copy_Expr()))->setType(type);
 }
 
 
@@ -262,12 +263,15 @@ void Bitor_class::dump(ostream& stream, int n)
 {
    stream << pad(n) << "_bitor\n";
    e1->dump(stream, n+2);
+   e2->dump(stream, n+2);
 }
 
 
 Object Object_class::copy_Object()
 {
-   return new Object_class(copy_Symbol(var));
+   Object copy = new Object_class(copy_Symbol(var));
+   copy->setType(type);
+   return copy;
 }
 
 void Object_class::dump(ostream& stream, int n)
@@ -279,7 +283,7 @@ void Object_class::dump(ostream& stream, int n)
 
 Expr Call_class::copy_Expr()
 {
-   return new Call_class(copy_Symbol(name), actuals->copy_list());
+   return (new Call_class(copy_Symbol(name), actuals->copy_list()))->setType(type);
 }
 
 void Call_class::dump(ostream& stream, int n)
@@ -291,7 +295,7 @@ void Call_class::dump(ostream& stream, int n)
 
 Expr Actual_class::copy_Expr()
 {
-   return new Actual_class(expr->copy_Expr());
+   return (new Actual_class(expr->copy_Expr()))->setType(type);
 }
 
 void Actual_class::dump(ostream& stream, int n)
@@ -303,7 +307,7 @@ void Actual_class::dump(ostream& stream, int n)
 
 Expr Const_int_class::copy_Expr()
 {
-   return new Const_int_class(copy_Symbol(value));
+   return (new Const_int_class(copy_Symbol(value)))->setType(type);
 }
 
 void Const_int_class::dump(ostream& stream, int n)
@@ -314,7 +318,7 @@ void Const_int_class::dump(ostream& stream, int n)
 
 Expr Const_string_class::copy_Expr()
 {
-   return new Const_string_class(copy_Symbol(value));
+   return (new Const_string_class(copy_Symbol(value)))->setType(type);
 }
 
 void Const_string_class::dump(ostream& stream, int n)
@@ -326,7 +330,7 @@ void Const_string_class::dump(ostream& stream, int n)
 
 Expr Const_float_class::copy_Expr()
 {
-   return new Const_float_class(copy_Symbol(value));
+   return (new Const_float_class(copy_Symbol(value)))->setType(type);
 }
 
 void Const_float_class::dump(ostream& stream, int n)
@@ -338,7 +342,7 @@ void Const_float_class::dump(ostream& stream, int n)
 
 Expr Const_bool_class::copy_Expr()
 {
-   return new Const_bool_class(copy_Boolean(value));
+   return (new Const_bool_class(copy_Boolean(value)))->setType(type);
 }
 
 void Const_bool_class::dump(ostream& stream, int n)
@@ -349,7 +353,7 @@ void Const_bool_class::dump(ostream& stream, int n)
 
 Expr No_expr_class::copy_Expr()
 {
-   return new No_expr_class();
+   return (new No_expr_class())->setType(type);
 }
 
 
@@ -12,18 +12,30 @@ typedef class Actual_class *Actual;
 typedef class Object_class *Object;
 typedef class Call_class *Call;
 
+// the built-in types as dense tags, kept with the type of an Expr;
+// any other type is NO_TYPE
+enum TypeTag { NO_TYPE, VOID_TYPE, INT_TYPE, FLOAT_TYPE, BOOL_TYPE, STRING_TYPE, TYPE_TAGS };
+TypeTag type_tag(Symbol type);
+Symbol tag_type(TypeTag tag);     // NULL for NO_TYPE
+
 
 class Expr_class : public Stmt_class {
 public:     
    Symbol type;                      
+   TypeTag tag;                      // type_tag(type)
    Stmt copy_Stmt() { return copy_Expr(); }   
    Symbol getType() { return type; }           
-   Expr setType(Symbol s) { type = s; return this; }           
-   Expr_class() { type = (Symbol) NULL; }
+   Expr setType(Symbol s) { type = s; tag = type_tag(s); return this; }           
+   TypeTag getTag() { return tag; }
+   Expr_class() { type = (Symbol) NULL; tag = NO_TYPE; }
    Expr_class(Symbol a1) {
         type = a1;
+        tag = type_tag(a1);
    }
    void check(Symbol s) {checkType();}
+   bool isReturn(){return false;}
+   bool isBreak(){return false;}
+   bool isContinue(){return false;}
    void dump_type(ostream&, int);
    
    virtual void dump_with_types(ostream&,int) = 0; 
@@ -32,6 +44,34 @@ public:
    virtual Symbol checkType() = 0;
    virtual bool is_empty_Expr() = 0;
    virtual void code(ostream&) = 0;
+   virtual void code_branch(ostream&, int, bool);
+   virtual bool argument_operand(std::string&);
+
+   // for optimization (cgen_opt.cc)
+   int size() { return 1; }
+   void collect_effects(SymbolSet&, bool&) {}
+   Stmt unswitch(int&) { return this; }
+   IfStmt find_invariant_if(SymbolSet&) { return NULL; }
+   virtual bool is_invariant(SymbolSet&) { return true; }
+   virtual bool is_const_bool(Boolean&) { return false; }
+   virtual bool is_const_int(long long&) { return false; }
+   void value_number(ValueTable &t) { value_number(t, NULL); }
+   virtual void value_number(ValueTable&, Expr*) {}
+   virtual std::string value_key() { return ""; }
+   virtual void collect_uses(SymbolSet&) {}
+   virtual void resolve_variables(FrameLayout&) {}
+   void constant_flow(ConstState&);
+   Stmt fold_constants() { return fold(); }
+   virtual ConstValue evaluate(ConstState&);
+   virtual Expr fold() { return this; }
+   Stmt eliminate_dead(SymbolSet&, bool);
+   void range_flow(RangeState&);
+   virtual Range evaluate_range(RangeState&);
+   virtual void refine_range(RangeState&, bool) {}
+   virtual double branch_probability() { return 0.5; }
+   virtual bool is_variable(Symbol&) { return false; }
+   virtual bool is_product(Expr&, Expr&) { return false; }
+   virtual int temporaries() { return 1; }
 };
 
 class Call_class : public Expr_class {
@@ -47,11 +87,23 @@ public:
    Actuals getActuals(){return actuals;}
    Expr copy_Expr();
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
 	void dump(ostream&,int);
    void dump_type(ostream& , int );
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_effects(ostream&);
+   void code_call(ostream&, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
 };
 
 
@@ -64,11 +116,22 @@ public:
    }
    Expr copy_Expr();
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
 	void dump(ostream&,int);
    void dump_type(ostream& , int );
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   bool argument_operand(std::string&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
 };
 
 // define constructor - expr
@@ -76,17 +139,31 @@ class Assign_class : public Expr_class {
 protected:
    Symbol lvalue;
    Expr value;
+   int slot;         // frame slot of lvalue, see resolve_variables
 public:
    Assign_class(Symbol a1, Expr a2)  {
       lvalue = a1;
       value = a2;
+      slot = GLOBAL_SLOT;
    }
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   Stmt eliminate_dead(SymbolSet&, bool);
+   bool is_assign(Symbol&, int&, Expr&);
 };
 
 // define constructor - add
@@ -102,9 +179,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructor - minus
@@ -120,9 +209,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructor - multi
@@ -138,9 +239,22 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int);
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   bool is_product(Expr&, Expr&);
 };
 
 // define constructor - divide
@@ -148,17 +262,31 @@ class Divide_class : public Expr_class {
 protected:
    Expr e1;
    Expr e2;
+   bool unsigned_operands;     // both in [0, 2^32), see cgen_opt.cc
 public:
    Divide_class(Expr a1, Expr a2) {
       e1 = a1;
       e2 = a2;
+      unsigned_operands = false;
    }
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructor - mod
@@ -166,17 +294,31 @@ class Mod_class : public Expr_class {
 protected:
    Expr e1;
    Expr e2;
+   bool unsigned_operands;     // both in [0, 2^32), see cgen_opt.cc
 public:
    Mod_class(Expr a1, Expr a2) {
       e1 = a1;
       e2 = a2;
+      unsigned_operands = false;
    }
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructor - -
@@ -190,9 +332,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructor - <
@@ -208,9 +362,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - <=
@@ -226,9 +395,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - ==
@@ -244,9 +428,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - !=
@@ -262,9 +461,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - >=
@@ -280,9 +494,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - >
@@ -298,9 +527,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - and &&
@@ -316,9 +560,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - or ||
@@ -334,9 +593,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - xor ^
@@ -352,9 +626,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructor - not !
@@ -368,9 +654,24 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   void code_branch(ostream&, int, bool);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   void refine_range(RangeState&, bool);
+   double branch_probability();
 };
 
 // define constructor - bitnot ~
@@ -384,9 +685,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 class Bitand_class : public Expr_class {
@@ -401,9 +714,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 class Bitor_class : public Expr_class {
@@ -418,9 +743,21 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   int size();
+   void collect_effects(SymbolSet&, bool&);
+   bool is_invariant(SymbolSet&);
+   void value_number(ValueTable&, Expr*);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
 };
 
 // define constructconst_int - const_int
@@ -434,9 +771,15 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   bool argument_operand(std::string&);
+   std::string value_key();
+   ConstValue evaluate(ConstState&);
+   bool is_const_int(long long&);
+   Range evaluate_range(RangeState&);
 };
 
 // define constructconst_string - const_string
@@ -450,9 +793,11 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   bool argument_operand(std::string&);
 };
 
 // define constructconst_float - const_float
@@ -466,9 +811,13 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   bool argument_operand(std::string&);
+   std::string value_key();
+   ConstValue evaluate(ConstState&);
 };
 
 // define constructconst_bool - const_bool
@@ -482,25 +831,44 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   bool argument_operand(std::string&);
+   void code_branch(ostream&, int, bool);
+   bool is_const_bool(Boolean&);
+   std::string value_key();
+   ConstValue evaluate(ConstState&);
 };
 
 class Object_class : public Expr_class {
 protected:
    Symbol var;
+   int slot;         // frame slot of var, see resolve_variables
 public:
    Object_class(Symbol a1) {
       var = a1;
+      slot = GLOBAL_SLOT;
    }
    Expr copy_Expr(){return copy_Object();};
    Object copy_Object();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return false;}
    Symbol checkType();
    void code(ostream&);
+   bool argument_operand(std::string&);
+   bool is_invariant(SymbolSet&);
+   std::string value_key();
+   void collect_uses(SymbolSet&);
+   void resolve_variables(FrameLayout&);
+   ConstValue evaluate(ConstState&);
+   Expr fold();
+   Range evaluate_range(RangeState&);
+   int temporaries();
+   bool is_variable(Symbol&);
 };
 
 // define constructor - no_expr
@@ -512,6 +880,7 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void flatten(FlatTree&);
    bool is_empty_Expr(){ return true;}
    Symbol checkType();
    void code(ostream&);
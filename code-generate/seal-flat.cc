@@ -0,0 +1,327 @@
+//**************************************************************
+//
+// FlatTree: the index-based copy of the AST, see seal-flat.h.
+//
+// Each tree class converts itself in its flatten method by opening
+// its node, flattening its children and closing the node again.
+//
+//**************************************************************
+
+#include "seal-flat.h"
+
+extern IdTable idtable;
+extern IntTable inttable;
+extern StrTable stringtable;
+extern FloatTable floattable;
+
+// what tree_node::dump prints for the node of each kind
+static const char *kind_names[NODE_KINDS] = {
+  "_program", "_variableDecl", "_variable", "_callDecl",
+  "_stmtBlock", "_ifStmt", "_whileStmt", "_forStmt", "_returnStmt", "_continueStmt", "_breakStmt",
+  "_call", "_actual", "_assign", "_add", "_minus", "_multi", "_divide", "_mod",
+  "_neg", "_lt", "_le", "_equ", "_neq", "_ge", "_gt", "_and", "_or", "_xor",
+  "_not", "_bitnot", "_bitand", "_bitor", "_const_int", "_const_string",
+  "_const_float", "_const_bool", "_object", "_no_expr"
+};
+
+FlatTree::FlatTree(Program program)
+{
+  program->flatten(*this);
+}
+
+void FlatTree::open(NodeKind kind, tree_node *node, TypeTag tag, unsigned int symbol)
+{
+  NodeId n = kinds.size();
+  kinds.push_back(kind);
+  lines.push_back(node->get_line_number());
+  tags.push_back(tag);
+  symbols.push_back(symbol);
+  first_child.push_back(0);
+  child_counts.push_back(0);
+  ends.push_back(0);
+
+  // n is a child of the innermost open node, and the nodes opened
+  // from now on until it closes are its children
+  pending.push_back(n);
+  open_marks.push_back(pending.size());
+}
+
+void FlatTree::close()
+{
+  NodeId n = pending[open_marks.back() - 1];
+  size_t mark = open_marks.back();
+  open_marks.pop_back();
+
+  first_child[n] = children.size();
+  child_counts[n] = pending.size() - mark;
+  children.insert(children.end(), pending.begin() + mark, pending.end());
+  pending.resize(mark);
+  ends[n] = kinds.size();
+}
+
+Symbol FlatTree::symbol(NodeId n) const
+{
+  if (symbols[n] == NO_SYMBOL)
+    return NULL;
+  switch (kind(n)) {
+  case CONST_INT_NODE:    return inttable.lookup(symbols[n]);
+  case CONST_STRING_NODE: return stringtable.lookup(symbols[n]);
+  case CONST_FLOAT_NODE:  return floattable.lookup(symbols[n]);
+  case CONST_BOOL_NODE:   return NULL;
+  default:                return idtable.lookup(symbols[n]);
+  }
+}
+
+// the children of n from first on to last, printed as a list
+void FlatTree::dump_list(ostream &stream, NodeId n, int first, int last, int padding) const
+{
+  if (first == last) {
+    stream << pad(padding) << "(nil)\n";
+    return;
+  }
+  if (last - first == 1) {
+    dump(stream, child(n, first), padding);
+    return;
+  }
+  stream << pad(padding) << "list\n";
+  for (int k = first; k < last; k++)
+    dump(stream, child(n, k), padding + 2);
+  stream << pad(padding) << "(end_of_list)\n";
+}
+
+// how many children of n from the first on are of the given kind
+int FlatTree::leading(NodeId n, NodeKind kind) const
+{
+  int k = 0;
+  while (k < child_count(n) && this->kind(child(n, k)) == kind)
+    k++;
+  return k;
+}
+
+void FlatTree::dump(ostream &stream, NodeId n, int padding) const
+{
+  stream << pad(padding) << kind_names[kind(n)] << "\n";
+  switch (kind(n)) {
+  case PROGRAM_NODE:
+  case CALL_NODE:
+    if (kind(n) == CALL_NODE)
+      dump_Symbol(stream, padding + 2, symbol(n));
+    dump_list(stream, n, 0, child_count(n), padding + 2);
+    return;
+  case VARIABLE_NODE:
+    dump_Symbol(stream, padding + 2, symbol(n));
+    dump_Symbol(stream, padding + 2, tag_type(tag(n)));
+    return;
+  case CALL_DECL_NODE: {
+    int paras = leading(n, VARIABLE_NODE);
+    dump_Symbol(stream, padding + 2, symbol(n));
+    dump_list(stream, n, 0, paras, padding + 2);
+    dump(stream, child(n, paras), padding + 2);
+    dump_Symbol(stream, padding + 2, tag_type(tag(n)));
+    return;
+  }
+  case STMT_BLOCK_NODE: {
+    int vars = leading(n, VARIABLE_DECL_NODE);
+    dump_list(stream, n, 0, vars, padding + 2);
+    dump_list(stream, n, vars, child_count(n), padding + 2);
+    return;
+  }
+  case ASSIGN_NODE:
+  case OBJECT_NODE:
+  case CONST_INT_NODE:
+  case CONST_STRING_NODE:
+  case CONST_FLOAT_NODE:
+    dump_Symbol(stream, padding + 2, symbol(n));
+    break;
+  case CONST_BOOL_NODE:
+    dump_Boolean(stream, padding + 2, boolean(n));
+    return;
+  default:
+    break;
+  }
+  for (NodeId c : children_of(n))
+    dump(stream, c, padding + 2);
+}
+
+//
+// Converting the tree
+//
+
+static unsigned int symbol_index(Symbol s)
+{
+  return s->get_index();
+}
+
+void Program_class::flatten(FlatTree &flat)
+{
+  flat.open(PROGRAM_NODE, this, NO_TYPE, NO_SYMBOL);
+  for (int i = decls->first(); decls->more(i); i = decls->next(i))
+    decls->nth(i)->flatten(flat);
+  flat.close();
+}
+
+void VariableDecl_class::flatten(FlatTree &flat)
+{
+  flat.open(VARIABLE_DECL_NODE, this, NO_TYPE, NO_SYMBOL);
+  variable->flatten(flat);
+  flat.close();
+}
+
+void Variable_class::flatten(FlatTree &flat)
+{
+  flat.open(VARIABLE_NODE, this, type_tag(type), symbol_index(name));
+  flat.close();
+}
+
+void CallDecl_class::flatten(FlatTree &flat)
+{
+  flat.open(CALL_DECL_NODE, this, type_tag(returnType), symbol_index(name));
+  for (int i = paras->first(); paras->more(i); i = paras->next(i))
+    paras->nth(i)->flatten(flat);
+  body->flatten(flat);
+  flat.close();
+}
+
+void StmtBlock_class::flatten(FlatTree &flat)
+{
+  flat.open(STMT_BLOCK_NODE, this, NO_TYPE, NO_SYMBOL);
+  for (int i = vars->first(); vars->more(i); i = vars->next(i))
+    vars->nth(i)->flatten(flat);
+  for (int i = stmts->first(); stmts->more(i); i = stmts->next(i))
+    stmts->nth(i)->flatten(flat);
+  flat.close();
+}
+
+void IfStmt_class::flatten(FlatTree &flat)
+{
+  flat.open(IF_NODE, this, NO_TYPE, NO_SYMBOL);
+  condition->flatten(flat);
+  thenexpr->flatten(flat);
+  elseexpr->flatten(flat);
+  flat.close();
+}
+
+void WhileStmt_class::flatten(FlatTree &flat)
+{
+  flat.open(WHILE_NODE, this, NO_TYPE, NO_SYMBOL);
+  condition->flatten(flat);
+  body->flatten(flat);
+  flat.close();
+}
+
+void ForStmt_class::flatten(FlatTree &flat)
+{
+  flat.open(FOR_NODE, this, NO_TYPE, NO_SYMBOL);
+  initexpr->flatten(flat);
+  condition->flatten(flat);
+  loopact->flatten(flat);
+  body->flatten(flat);
+  flat.close();
+}
+
+void ReturnStmt_class::flatten(FlatTree &flat)
+{
+  flat.open(RETURN_NODE, this, NO_TYPE, NO_SYMBOL);
+  value->flatten(flat);
+  flat.close();
+}
+
+void ContinueStmt_class::flatten(FlatTree &flat)
+{
+  flat.open(CONTINUE_NODE, this, NO_TYPE, NO_SYMBOL);
+  flat.close();
+}
+
+void BreakStmt_class::flatten(FlatTree &flat)
+{
+  flat.open(BREAK_NODE, this, NO_TYPE, NO_SYMBOL);
+  flat.close();
+}
+
+void Call_class::flatten(FlatTree &flat)
+{
+  flat.open(CALL_NODE, this, tag, symbol_index(name));
+  for (int i = actuals->first(); actuals->more(i); i = actuals->next(i))
+    actuals->nth(i)->flatten(flat);
+  flat.close();
+}
+
+void Actual_class::flatten(FlatTree &flat)
+{
+  flat.open(ACTUAL_NODE, this, tag, NO_SYMBOL);
+  expr->flatten(flat);
+  flat.close();
+}
+
+void Assign_class::flatten(FlatTree &flat)
+{
+  flat.open(ASSIGN_NODE, this, tag, symbol_index(lvalue));
+  value->flatten(flat);
+  flat.close();
+}
+
+// an operator node and its operands
+static void flatten_operator(FlatTree &flat, NodeKind kind, Expr e, Expr e1, Expr e2)
+{
+  flat.open(kind, e, e->getTag(), NO_SYMBOL);
+  e1->flatten(flat);
+  if (e2 != NULL)
+    e2->flatten(flat);
+  flat.close();
+}
+
+void Add_class::flatten(FlatTree &flat)    { flatten_operator(flat, ADD_NODE, this, e1, e2); }
+void Minus_class::flatten(FlatTree &flat)  { flatten_operator(flat, MINUS_NODE, this, e1, e2); }
+void Multi_class::flatten(FlatTree &flat)  { flatten_operator(flat, MULTI_NODE, this, e1, e2); }
+void Divide_class::flatten(FlatTree &flat) { flatten_operator(flat, DIVIDE_NODE, this, e1, e2); }
+void Mod_class::flatten(FlatTree &flat)    { flatten_operator(flat, MOD_NODE, this, e1, e2); }
+void Neg_class::flatten(FlatTree &flat)    { flatten_operator(flat, NEG_NODE, this, e1, NULL); }
+void Lt_class::flatten(FlatTree &flat)     { flatten_operator(flat, LT_NODE, this, e1, e2); }
+void Le_class::flatten(FlatTree &flat)     { flatten_operator(flat, LE_NODE, this, e1, e2); }
+void Equ_class::flatten(FlatTree &flat)    { flatten_operator(flat, EQU_NODE, this, e1, e2); }
+void Neq_class::flatten(FlatTree &flat)    { flatten_operator(flat, NEQ_NODE, this, e1, e2); }
+void Ge_class::flatten(FlatTree &flat)     { flatten_operator(flat, GE_NODE, this, e1, e2); }
+void Gt_class::flatten(FlatTree &flat)     { flatten_operator(flat, GT_NODE, this, e1, e2); }
+void And_class::flatten(FlatTree &flat)    { flatten_operator(flat, AND_NODE, this, e1, e2); }
+void Or_class::flatten(FlatTree &flat)     { flatten_operator(flat, OR_NODE, this, e1, e2); }
+void Xor_class::flatten(FlatTree &flat)    { flatten_operator(flat, XOR_NODE, this, e1, e2); }
+void Not_class::flatten(FlatTree &flat)    { flatten_operator(flat, NOT_NODE, this, e1, NULL); }
+void Bitnot_class::flatten(FlatTree &flat) { flatten_operator(flat, BITNOT_NODE, this, e1, NULL); }
+void Bitand_class::flatten(FlatTree &flat) { flatten_operator(flat, BITAND_NODE, this, e1, e2); }
+void Bitor_class::flatten(FlatTree &flat)  { flatten_operator(flat, BITOR_NODE, this, e1, e2); }
+
+void Const_int_class::flatten(FlatTree &flat)
+{
+  flat.open(CONST_INT_NODE, this, tag, symbol_index(value));
+  flat.close();
+}
+
+void Const_string_class::flatten(FlatTree &flat)
+{
+  flat.open(CONST_STRING_NODE, this, tag, symbol_index(value));
+  flat.close();
+}
+
+void Const_float_class::flatten(FlatTree &flat)
+{
+  flat.open(CONST_FLOAT_NODE, this, tag, symbol_index(value));
+  flat.close();
+}
+
+void Const_bool_class::flatten(FlatTree &flat)
+{
+  flat.open(CONST_BOOL_NODE, this, tag, value ? 1 : 0);
+  flat.close();
+}
+
+void Object_class::flatten(FlatTree &flat)
+{
+  flat.open(OBJECT_NODE, this, tag, symbol_index(var));
+  flat.close();
+}
+
+void No_expr_class::flatten(FlatTree &flat)
+{
+  flat.open(NO_EXPR_NODE, this, tag, NO_SYMBOL);
+  flat.close();
+}
@@ -0,0 +1,118 @@
+#ifndef _H_seal_flat
+#define _H_seal_flat
+
+#include <vector>
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "seal-expr.h"
+
+//
+// FlatTree: a compact copy of a Program for walks that only read it.
+// Nodes are numbered in preorder, the root is node 0, and each node is
+// described by its entry in parallel arrays:
+//
+//   kinds        its NodeKind
+//   lines        its line number
+//   tags         the TypeTag of an expression, of a variable's type or
+//                of a function's return type; NO_TYPE for the rest
+//   symbols      the index of its name or constant in the string table
+//                for its kind (see symbol()), the value of a Bool
+//                constant, or NO_SYMBOL
+//   first_child  where its children start in `children'
+//   child_counts how many children it has
+//   ends         one past its last descendant: the subtree of n is
+//                the nodes n .. ends[n] - 1
+//
+// Lists are flattened away, their elements are children of the node
+// that holds the list:
+//
+//   PROGRAM_NODE        its decls
+//   CALL_DECL_NODE      a VARIABLE_NODE per parameter, then the body
+//   STMT_BLOCK_NODE     a VARIABLE_DECL_NODE per variable, then the
+//                       statements
+//   CALL_NODE           an ACTUAL_NODE per actual
+//
+// Every other kind has a fixed number of children, in the order the
+// class keeps them.
+//
+
+enum NodeKind {
+  PROGRAM_NODE, VARIABLE_DECL_NODE, VARIABLE_NODE, CALL_DECL_NODE,
+  STMT_BLOCK_NODE, IF_NODE, WHILE_NODE, FOR_NODE, RETURN_NODE, CONTINUE_NODE, BREAK_NODE,
+  CALL_NODE, ACTUAL_NODE, ASSIGN_NODE, ADD_NODE, MINUS_NODE, MULTI_NODE, DIVIDE_NODE, MOD_NODE,
+  NEG_NODE, LT_NODE, LE_NODE, EQU_NODE, NEQ_NODE, GE_NODE, GT_NODE, AND_NODE, OR_NODE, XOR_NODE,
+  NOT_NODE, BITNOT_NODE, BITAND_NODE, BITOR_NODE, CONST_INT_NODE, CONST_STRING_NODE,
+  CONST_FLOAT_NODE, CONST_BOOL_NODE, OBJECT_NODE, NO_EXPR_NODE,
+  NODE_KINDS
+};
+
+typedef unsigned int NodeId;
+
+#define NO_SYMBOL 0xffffffffu
+
+class FlatTree {
+private:
+  std::vector<unsigned char> kinds;
+  std::vector<int> lines;
+  std::vector<unsigned char> tags;
+  std::vector<unsigned int> symbols;
+  std::vector<NodeId> first_child;
+  std::vector<NodeId> child_counts;
+  std::vector<NodeId> ends;
+  std::vector<NodeId> children;
+
+  // while converting: the nodes opened and not yet moved to children,
+  // and for each open node where its children start in pending
+  std::vector<NodeId> pending;
+  std::vector<size_t> open_marks;
+
+  void dump_list(ostream &stream, NodeId n, int first, int last, int padding) const;
+  int leading(NodeId n, NodeKind kind) const;
+
+public:
+  // a copy of the tree under program
+  FlatTree(Program program);
+
+  // used by the flatten methods of the tree classes: open starts a
+  // node, which gets the nodes opened until the matching close as its
+  // descendants
+  void open(NodeKind kind, tree_node *node, TypeTag tag, unsigned int symbol);
+  void close();
+
+  //
+  // Traversal
+  //
+  NodeId root() const               { return 0; }
+  int size() const                  { return kinds.size(); }
+  NodeKind kind(NodeId n) const     { return (NodeKind) kinds[n]; }
+  int line(NodeId n) const          { return lines[n]; }
+  TypeTag tag(NodeId n) const       { return (TypeTag) tags[n]; }
+  bool boolean(NodeId n) const      { return symbols[n] != 0; }
+  Symbol symbol(NodeId n) const;    // NULL for a node without one
+
+  int child_count(NodeId n) const   { return child_counts[n]; }
+  NodeId child(NodeId n, int k) const { return children[first_child[n] + k]; }
+  NodeId subtree_end(NodeId n) const  { return ends[n]; }
+
+  // the children of n as a range, as in
+  //
+  //   for (NodeId c : flat.children_of(n)) ...
+  //
+  struct Range {
+    const NodeId *first, *last;
+    const NodeId *begin() const { return first; }
+    const NodeId *end() const   { return last; }
+  };
+  Range children_of(NodeId n) const
+  {
+    Range r;
+    r.first = children.data() + first_child[n];
+    r.last = r.first + child_counts[n];
+    return r;
+  }
+
+  // prints the subtree of n the way tree_node::dump prints the tree
+  void dump(ostream &stream, NodeId n, int padding) const;
+};
+
+#endif
@@ -20,6 +20,8 @@ public:
 
 	void semant();
 	void cgen(ostream&);
+	void cgen_single_pass(ostream&);
+	void flatten(FlatTree&);
 	// for semantic analysis
 };
 
@@ -31,27 +33,88 @@ public:
 	virtual void dump_with_types(ostream&,int) = 0; 
 	virtual void dump(ostream&,int) = 0;
 	virtual void check(Symbol) = 0;
+	virtual bool isReturn() = 0;
+	virtual bool isBreak() = 0;
+	virtual bool isContinue() = 0;
 	virtual void code(ostream&) = 0;
+	virtual void code_effects(ostream &s) { code(s); }
+
+	// for optimization (cgen_opt.cc)
+	virtual int size() = 0;
+	virtual void collect_effects(SymbolSet&, bool&) = 0;
+	virtual Stmt unswitch(int&) = 0;
+	virtual IfStmt find_invariant_if(SymbolSet&) = 0;
+	virtual void value_number(ValueTable&) = 0;
+	virtual void constant_flow(ConstState&) = 0;
+	virtual Stmt fold_constants() = 0;
+	virtual void collect_uses(SymbolSet&) = 0;
+	virtual void resolve_variables(FrameLayout&) = 0;
+	virtual void flatten(FlatTree&) = 0;
+	virtual Stmt eliminate_dead(SymbolSet&, bool) = 0;
+	virtual void range_flow(RangeState&) = 0;
+	virtual bool is_assign(Symbol&, int&, Expr&) { return false; }
 };
 
 class StmtBlock_class : public Stmt_class {
 protected:
 	 VariableDecls vars;
 	 Stmts	stmts;
+	 int first_slot;	// frame slot of the first of vars, see resolve_variables
 public:
 	StmtBlock_class(VariableDecls a1, Stmts a2) {
 		vars = a1;
 	    stmts = a2;
+	    first_slot = 0;
 	}
 	Stmt copy_Stmt(){return copy_StmtBlock();}
 	Stmts getStmts(){return stmts;}
 
 	VariableDecls getVariableDecls(){return vars;};
+	void setVariableDecls(VariableDecls v){vars = v;}
 	StmtBlock copy_StmtBlock();
 	void dump(ostream& , int );
 	void dump_with_types(ostream&,int);
 	void check(Symbol);
+	bool isReturn() {
+		bool flag = false;
+		for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+			if (stmts->nth(i)->isReturn() == true) {
+				flag = true;
+			}
+		}
+		return flag;
+	}
+	bool isBreak() {
+		bool flag = false;
+		for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+			if (stmts->nth(i)->isBreak() == true) {
+				flag = true;
+			}
+		}
+		return flag;
+	}
+	bool isContinue() {
+		bool flag = false;
+		for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+			if (stmts->nth(i)->isContinue() == true) {
+				flag = true;
+			}
+		}
+		return flag;
+	}
 	void code(ostream&);
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 class IfStmt_class : public Stmt_class {
@@ -66,13 +129,31 @@ public:
 		elseexpr = a3;
 	}
 	Expr getCondition(){return condition;}
+	void setCondition(Expr e){condition = e;}
 	StmtBlock getThen(){return thenexpr;}
 	StmtBlock getElse(){return elseexpr;}
     Stmt copy_Stmt();
 	void dump(ostream& stream, int n);
 	void dump_with_types(ostream&,int);
 	void check(Symbol);
+	bool isReturn(){return false;}
+	bool isBreak(){return false;}
+	bool isContinue(){return false;}
 	void code(ostream&);
+	bool code_select(ostream&);
+	double then_probability();
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 
@@ -93,7 +174,22 @@ public:
 	void dump(ostream& stream, int n);
 	void dump_with_types(ostream&,int);
 	void check(Symbol);
+	bool isReturn(){return false;}
+	bool isBreak(){return false;}
+	bool isContinue(){return false;}
 	void code(ostream&);
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 class ForStmt_class : public Stmt_class {
@@ -115,7 +211,22 @@ public:
 	void dump(ostream& stream, int n);
 	void dump_with_types(ostream&,int);
 	void check(Symbol);
+	bool isReturn(){return false;}
+	bool isBreak(){return false;}
+	bool isContinue(){return false;}
 	void code(ostream&);
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 
@@ -132,7 +243,22 @@ public:
     void dump_with_types(ostream&,int);
     void dump(ostream& stream, int n);
 	void check(Symbol);
+	bool isReturn(){return true;}
+	bool isBreak(){return false;}
+	bool isContinue(){return false;}
 	void code(ostream&);
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 class ContinueStmt_class : public Stmt_class {
@@ -142,7 +268,22 @@ public:
     void dump_with_types(ostream&,int);
     void dump(ostream& stream, int n);
 	void check(Symbol);
+	bool isReturn(){return false;}
+	bool isBreak(){return false;}
+	bool isContinue(){return true;}
 	void code(ostream&);
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 
@@ -153,7 +294,22 @@ public:
     void dump_with_types(ostream&,int);
     void dump(ostream& stream, int n);
 	void check(Symbol);
+	bool isReturn(){return false;}
+	bool isBreak(){return true;}
+	bool isContinue(){return false;}
 	void code(ostream&);
+	int size();
+	void collect_effects(SymbolSet&, bool&);
+	Stmt unswitch(int&);
+	IfStmt find_invariant_if(SymbolSet&);
+	void value_number(ValueTable&);
+	void constant_flow(ConstState&);
+	Stmt fold_constants();
+	void collect_uses(SymbolSet&);
+	void resolve_variables(FrameLayout&);
+	void flatten(FlatTree&);
+	Stmt eliminate_dead(SymbolSet&, bool);
+	void range_flow(RangeState&);
 };
 
 typedef class Program_class *Program;
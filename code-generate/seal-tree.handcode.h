@@ -5,6 +5,9 @@
 #define SEAL_TREE_HANDCODE_H
 
 #include <iostream>
+#include <set>
+#include <map>
+#include <string>
 #include "tree.h"
 #include "seal.h"
 #include "stringtab.h"
@@ -95,5 +98,18 @@ typedef Actuals_class *Actuals;
 typedef list_node<Constant> Constants_class;
 typedef Constants_class *Constants;
 
+typedef std::set<Symbol> SymbolSet;
+typedef std::map<Symbol, double> CallCounts;
+class ValueTable;
+struct ConstValue;
+struct ConstState;
+struct Range;
+struct RangeState;
+struct FrameLayout;
+class FlatTree;
+
+// the slot of a variable reference that names a global, not a local
+enum { GLOBAL_SLOT = -1 };
+
 
 #endif
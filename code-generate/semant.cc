@@ -0,0 +1,834 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include "semant.h"
+#include "cgen.h"
+#include "utilities.h"
+#include <map>
+#include <vector>
+
+extern int semant_debug;
+extern int cgen_whole_program;
+extern char *curr_filename;
+
+static ostream& error_stream = cerr;
+int semant_errors = 0;
+static Decl curr_decl = 0;
+
+// the parameters and locals in scope while checking a function, each
+// bound to its frame slot: with -fsingle-pass the code generator takes
+// the slots from these scopes instead of building its own (see
+// Program_class::cgen_single_pass)
+static FrameLayout frame;
+static SymbolTable<Symbol, int> &objectEnv = frame.scopes;
+
+typedef std::map<Symbol, Symbol> CallTable;
+CallTable callTable;
+
+// globalVars stores global variables' name and type
+typedef std::map<Symbol, Symbol> GlobalVariables;
+GlobalVariables globalVars;
+
+// localVars stores local variables' name and type
+typedef std::map<Symbol, Symbol> LocalVariables;
+LocalVariables localVars;
+
+// MethodClass stores para type
+// MethodTable stores name and related paras
+typedef std::vector<Symbol> MethodClass;
+typedef std::map<Symbol, MethodClass> MethodTable;
+MethodTable methodTable;
+
+// InstallTable marks whether function is installed or not
+typedef std::map<Symbol, bool> InstallTable;
+InstallTable installTable;
+
+///////////////////////////////////////////////
+// helper func
+///////////////////////////////////////////////
+
+
+static ostream& semant_error() {
+    semant_errors++;
+    return error_stream;
+}
+
+static ostream& semant_error(tree_node *t) {
+    error_stream << t->get_line_number() << ": ";
+    return semant_error();
+}
+
+static ostream& internal_error(int lineno) {
+    error_stream << "FATAL:" << lineno << ": ";
+    return error_stream;
+}
+
+//////////////////////////////////////////////////////////////////////
+//
+// Symbols
+//
+// For convenience, a large number of symbols are predefined here.
+// These symbols include the primitive type and method names, as well
+// as fixed names used by the runtime system.
+//
+//////////////////////////////////////////////////////////////////////
+
+static Symbol 
+    Int,
+    Float,
+    String,
+    Bool,
+    Void,
+    Main,
+    print
+    ;
+
+bool isValidCallName(Symbol type) {
+    return type != (Symbol)print;
+}
+
+bool isValidTypeName(Symbol type) {
+    return type != Void;
+}
+
+// the type of each TypeTag, filled in by initialize_constants
+static Symbol tag_types[TYPE_TAGS];
+
+TypeTag type_tag(Symbol type) {
+    for (int t = VOID_TYPE; t < TYPE_TAGS; t++) {
+        if (tag_types[t] != NULL && tag_types[t] == type) {
+            return (TypeTag) t;
+        }
+    }
+    return NO_TYPE;
+}
+
+Symbol tag_type(TypeTag tag) {
+    return tag_types[tag];
+}
+
+//
+// The types of operators. For each kind of operator and each pair of
+// operand tags, operator_types holds the tag of the result, or MISMATCH
+// when the operands do not fit the operator; unary operators look up
+// their operand as both. Filled in by install_operator_types.
+//
+enum OperatorKind {
+    ARITHMETIC_OPERATOR,    // + - * /
+    MODULO_OPERATOR,        // %
+    ORDER_OPERATOR,         // < <= >= >
+    EQUALITY_OPERATOR,      // == !=
+    LOGICAL_OPERATOR,       // && ||
+    XOR_OPERATOR,           // ^
+    BITWISE_OPERATOR,       // & |
+    NEGATION_OPERATOR,      // unary -
+    NOT_OPERATOR,           // !
+    BITNOT_OPERATOR,        // ~
+    OPERATOR_KINDS
+};
+
+#define MISMATCH -1
+static int operator_types[OPERATOR_KINDS][TYPE_TAGS][TYPE_TAGS];
+
+static bool numeric(int tag) {
+    return tag == INT_TYPE || tag == FLOAT_TYPE;
+}
+
+static void install_operator_types() {
+    for (int l = 0; l < TYPE_TAGS; l++) {
+        for (int r = 0; r < TYPE_TAGS; r++) {
+            bool mixed = numeric(l) && numeric(r) && l != r;
+            operator_types[ARITHMETIC_OPERATOR][l][r] = mixed ? FLOAT_TYPE : l == r ? l : MISMATCH;
+            // codegen has only the integer remainder
+            operator_types[MODULO_OPERATOR][l][r] = l == INT_TYPE && r == INT_TYPE ? INT_TYPE : MISMATCH;
+            operator_types[ORDER_OPERATOR][l][r] = numeric(l) && numeric(r) ? BOOL_TYPE : MISMATCH;
+            operator_types[EQUALITY_OPERATOR][l][r] =
+                (numeric(l) && numeric(r)) || (l == BOOL_TYPE && r == BOOL_TYPE) ? BOOL_TYPE : MISMATCH;
+            operator_types[LOGICAL_OPERATOR][l][r] = l == BOOL_TYPE && r == BOOL_TYPE ? BOOL_TYPE : MISMATCH;
+            operator_types[XOR_OPERATOR][l][r] = l == r && (l == BOOL_TYPE || l == INT_TYPE) ? BOOL_TYPE : MISMATCH;
+            operator_types[BITWISE_OPERATOR][l][r] = l == INT_TYPE && r == INT_TYPE ? INT_TYPE : MISMATCH;
+            operator_types[NEGATION_OPERATOR][l][r] = MISMATCH;
+            operator_types[NOT_OPERATOR][l][r] = MISMATCH;
+            operator_types[BITNOT_OPERATOR][l][r] = MISMATCH;
+        }
+        operator_types[NEGATION_OPERATOR][l][l] = numeric(l) ? l : MISMATCH;
+        operator_types[NOT_OPERATOR][l][l] = l == BOOL_TYPE ? BOOL_TYPE : MISMATCH;
+        operator_types[BITNOT_OPERATOR][l][l] = l == INT_TYPE ? INT_TYPE : MISMATCH;
+    }
+}
+
+// the type of op applied to the checked e1 and e2 into t; false when
+// they do not fit op. A result of e1's tag is e1's own type.
+static bool operator_type(OperatorKind op, Expr e1, Expr e2, Symbol &t) {
+    int tag = operator_types[op][e1->getTag()][e2->getTag()];
+    if (tag == MISMATCH) {
+        return false;
+    }
+    t = tag == e1->getTag() ? e1->getType() : tag_types[tag];
+    return true;
+}
+
+//
+// Initializing the predefined symbols.
+//
+
+static void initialize_constants(void) {
+    // 4 basic types and Void type
+    Bool        = idtable.add_string("Bool");
+    Int         = idtable.add_string("Int");
+    String      = idtable.add_string("String");
+    Float       = idtable.add_string("Float");
+    Void        = idtable.add_string("Void");  
+    // main function
+    Main        = idtable.add_string("main");
+
+    // classical function to print things, so defined here for call.
+    print        = idtable.add_string("printf");
+
+    tag_types[VOID_TYPE]   = Void;
+    tag_types[INT_TYPE]    = Int;
+    tag_types[FLOAT_TYPE]  = Float;
+    tag_types[BOOL_TYPE]   = Bool;
+    tag_types[STRING_TYPE] = String;
+    install_operator_types();
+}
+
+/*
+    TODO :
+    you should fill the following function defines, so that semant() can realize a semantic 
+    analysis in a recursive way. 
+    Of course, you can add any other functions to help.
+*/
+
+static void install_calls(Decls decls) {
+    for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+        Symbol name = decls->nth(i)->getName();
+        Symbol type = decls->nth(i)->getType();
+        if (decls->nth(i)->isCallDecl()) {
+            if (callTable[name] != NULL) {
+                semant_error(decls->nth(i))<<"Function "<<name<<" was previously defined."<<endl;
+            } else if (type != Int && type != Void && type != String && type != Float && type != Bool) {
+                semant_error(decls->nth(i))<<"Function returnType error."<<endl;
+            } else if (!isValidCallName(name)) {
+                semant_error(decls->nth(i))<<"Function printf cannot have a name as printf"<<endl;
+            }
+            callTable[name] = type;
+            installTable[name] = false;
+            decls->nth(i)->check();
+        }
+    }
+}
+
+static void install_globalVars(Decls decls) {
+    for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+        Symbol name = decls->nth(i)->getName();
+        Symbol type = decls->nth(i)->getType();
+        if (!decls->nth(i)->isCallDecl()) {
+            if (globalVars[name] != NULL) {
+                semant_error(decls->nth(i))<<"Global variable redefined."<<endl;
+            } else if (type == Void) {
+                semant_error(decls->nth(i))<<"var "<<name<<" cannot be of type Void. Void can just be used as return type."<<endl;
+            } else if (name == print) {
+                semant_error(decls->nth(i))<<"Variable printf cannot have a name as printf"<<endl;
+            }
+            globalVars[name] = type;
+        }
+    }
+}
+
+static void check_calls(Decls decls) {
+    objectEnv.enterscope();
+    for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
+        if (decls->nth(i)->isCallDecl()) {
+            check_call(decls->nth(i));
+        }
+    }
+    objectEnv.exitscope();
+}
+
+static void check_main() {
+    if (callTable[Main] == NULL) {
+        semant_error()<<"main function is not defined."<<endl;
+    }
+}
+
+void VariableDecl_class::check() {
+    Symbol name = this->getName();
+    Symbol type = this->getType();
+    if (type == Void) {
+        semant_error()<<"var "<<name<<" cannot be of type Void. Void can just be used as return type."<<endl;
+    } else {
+        frame.declare(name);
+        localVars[name] = type;
+    }
+}
+
+void CallDecl_class::check() {
+    Variables vars = this->getVariables();
+    Symbol funcName = this->getName(); 
+    Symbol returnType = this->getType();
+    StmtBlock stmtblock = this->getBody();
+    
+    frame.slots.clear();
+    objectEnv.enterscope();
+    // install paras
+    if (installTable[name] == false) {
+        // methodclass stores paras type
+        MethodClass mclass;
+        int parasNum = 0;
+        for (int j=vars->first(); vars->more(j); j=vars->next(j)) {
+            Symbol name = vars->nth(j)->getName();
+            Symbol type = vars->nth(j)->getType();
+            parasNum ++;
+            
+            /* No need to check paras' type because of syntax rules */
+
+            // check if there are duplicated paras
+            if (objectEnv.lookup(name) != NULL) {
+                semant_error(this)<<"Function "<<funcName<< "'s parameter has a duplicate name "<<name<<endl;
+            }
+            frame.declare(name);
+            localVars[name] = type;
+            mclass.push_back(type);
+        }
+
+        // -fwhole-program passes the arguments past the sixth on the stack
+        if (parasNum > 6 && !cgen_whole_program) {
+            semant_error(this)<<"Function can't have more than six called parameters"<<endl;
+        }
+
+        // methodTable map paras to funcname
+        methodTable[funcName] = mclass;
+        installTable[name] = true;
+    } else {
+        for (int j=vars->first(); vars->more(j); j=vars->next(j)) {
+            Symbol name = vars->nth(j)->getName();
+            Symbol type = vars->nth(j)->getType();
+            
+            /* No need to check paras' type because of syntax rules */
+
+            // check if there are duplicated paras
+            if (objectEnv.lookup(name) != NULL) {
+                semant_error(this)<<"Function "<<funcName<< "'s parameter has a duplicate name "<<name<<endl;
+            }
+            frame.declare(name);
+            localVars[name] = type;
+        }
+        // main function should not have any paras
+        if (funcName == Main && vars->len() != 0) {
+            semant_error(this)<<"Main function should not have paras"<<endl;
+        } else if (callTable[Main] != Void) {
+            semant_error(this)<<"main function should have return type Void."<<endl;
+        }
+
+        // check stmtBlock, which declares its own variableDecls
+        stmtblock->check(returnType);
+        if (!stmtblock->isReturn()) {
+            semant_error(this)<<"Function "<<name<<" must have an overall return statement."<<endl;
+        }
+        if (stmtblock->isBreak()) {
+            Stmts stmts = stmtblock->getStmts();
+            for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+                if (stmts->nth(i)->isBreak()) {
+                    semant_error(stmts->nth(i))<<"break must be used in a loop sentence"<<endl;
+                }
+            }
+        }
+        if (stmtblock->isContinue()) {
+            Stmts stmts = stmtblock->getStmts();
+            for (int i=stmts->first(); stmts->more(i); i=stmts->next(i)) {
+                if (stmts->nth(i)->isContinue()) {
+                    semant_error(stmts->nth(i))<<"continue must be used in a loop sentence."<<endl;
+                }
+            }
+        }
+        slot_count = frame.slots.size();
+    }
+
+    objectEnv.exitscope();
+}
+
+void StmtBlock_class::check(Symbol type) {
+    VariableDecls vars = this->getVariableDecls();
+    Stmts stmts = this->getStmts(); 
+
+    objectEnv.enterscope();
+    first_slot = frame.slots.size();
+
+    for(int n=vars->first(); vars->more(n); n=vars->next(n)){
+
+        Symbol vars_name = vars->nth(n)->getName();
+        Symbol vars_type = vars->nth(n)->getType();
+
+        if(objectEnv.probe(vars_name) != NULL){
+            semant_error(vars->nth(n))<<"var "<<vars_name<< "was previously defined."<<endl;
+        }
+        else vars->nth(n)->check();
+    }
+
+    for (int j=stmts->first(); stmts->more(j); j=stmts->next(j)) {
+        stmts->nth(j)->check(type);
+    }
+
+    objectEnv.exitscope();
+}
+
+void IfStmt_class::check(Symbol type) {
+    Expr condition = this->getCondition();
+    StmtBlock thenExpr = this->getThen();
+    StmtBlock elseExpr = this->getElse();
+    
+    // If condition should be Bool
+    Symbol conditionType = condition->checkType();
+    if (conditionType != Bool) {
+        semant_error(this)<<"condition type should be Bool, but found"<<conditionType<<endl;
+    }
+
+    // check thenExpr and elseExpr
+    thenExpr->check(type);
+    elseExpr->check(type);
+}
+
+void WhileStmt_class::check(Symbol type) {
+    Expr condition = this->getCondition();
+    StmtBlock body = this->getBody();
+
+    // While condition should be Bool
+    Symbol conditionType = condition->checkType();
+    if (conditionType != Bool) {
+        semant_error(this)<<"condition type should be Bool, but found"<<conditionType<<endl;
+    }
+
+    // check while body
+    body->check(type);
+}
+
+void ForStmt_class::check(Symbol type) {
+    Expr init = this->getInit();
+    Expr condition = this->getCondition();
+    Expr loop = this->getLoop();
+    StmtBlock body = this->getBody();
+
+    init->checkType();
+    loop->checkType();
+    // For condition should be Bool
+    if(condition->is_empty_Expr() == false){
+        Symbol conditionType = condition->checkType();
+        if(conditionType != Bool){
+        semant_error(this)<<"Condition must be a Bool, got "<<conditionType<<endl;
+        }
+    }
+
+    // check For body
+    body->check(type);
+}
+
+void ReturnStmt_class::check(Symbol type) {
+    Expr expr = this->getValue();
+    
+    // check if return Type match
+    Symbol returnType = expr->checkType();
+    if (returnType != Void) {
+        if (expr->is_empty_Expr() && type != Void) {
+            semant_error(this)<<"Returns Void, but need "<<type<<endl;
+        } else if (!expr->is_empty_Expr() && type != returnType) {
+            semant_error(this)<<"Returns "<<returnType<<" but need "<<type<<endl;
+        }
+    }
+}
+
+void ContinueStmt_class::check(Symbol type) {
+    
+}
+
+void BreakStmt_class::check(Symbol type) {
+
+}
+
+Symbol Call_class::checkType(){
+    Symbol name = this->getName();
+    Actuals actuals = this->getActuals();
+    unsigned int j = 0;
+    
+    if (name == print) {
+        if (actuals->len() == 0) {
+            semant_error(this)<<"printf() must has at last one parameter of type String."<<endl;
+            this->setType(Void);
+            return type;
+        }
+        Symbol sym = actuals->nth(actuals->first())->checkType();
+        if (sym != String) {
+            semant_error(this)<<"printf()'s first parameter must be of type String."<<endl;
+            this->setType(Void);
+            return type;
+        }
+
+        for(int i=actuals->next(actuals->first()); actuals->more(i); i=actuals->next(i)) {
+            actuals->nth(i)->checkType();
+        }
+
+        this->setType(Void);
+        return type;
+    }
+
+    if (actuals->len() != int(methodTable[name].size())) {
+        semant_error(this)<<"Wrong number of paras"<<endl;
+    }
+    if (actuals->len() > 6 && !cgen_whole_program) {
+        semant_error(this)<<"Function can't have more than six called parameters"<<endl;
+    }
+
+    // each actual is checked once, its type is then kept in the node
+    for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+        Symbol sym = actuals->nth(i)->checkType();
+        // check function call's paras fit funcdecl's paras
+        if (j < methodTable[name].size() && sym != methodTable[name][j]) {
+            semant_error(this)<<"Function "<<name<<", type "<<sym<<" does not conform to declared type "<<methodTable[name][j]<<endl;
+        }
+        j ++;
+    }
+    
+    if (callTable[name] == NULL) {
+        semant_error(this)<<"Object "<<name<<" has not been defined"<<endl;
+        this->setType(Void);
+        return type;
+    } 
+    this->setType(callTable[name]);
+    return type;
+}
+
+Symbol Actual_class::checkType(){
+    Symbol sym = expr->checkType();
+    this->setType(sym);
+    return type;
+}
+
+Symbol Assign_class::checkType(){
+    if (objectEnv.lookup(lvalue) == NULL && globalVars[lvalue] == NULL) {
+        semant_error(this)<<"Undefined value"<<endl;
+    } 
+    slot = frame.slot(lvalue);
+
+    Symbol rs = value->checkType();
+    Symbol ls;
+    if (localVars[lvalue] != NULL) {
+        ls = localVars[lvalue];
+    } else {
+        ls = globalVars[lvalue];
+    }
+    if (ls != rs) {
+        semant_error(this)<<"assign value mismatch"<<" lvalue has type "<<ls<<" rvalue has type "<<rs<<endl;
+    }    
+    this->setType(rs);
+    return type;
+}
+
+Symbol Add_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"lvalue and rvalue should have same type."<<endl;
+        t = ls;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Minus_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Multi_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Divide_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Mod_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(MODULO_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Neg_class::checkType(){
+    Symbol ls = e1->checkType();
+    Symbol t;
+    if (!operator_type(NEGATION_OPERATOR, e1, e1, t)) {
+        semant_error(this)<<"Neg_class should have Int type"<<endl;
+        t = Int;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Lt_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"ltype mismatch rvalue"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Le_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"ltype mismatch rtype"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Equ_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(EQUALITY_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"ltype mismatch rtype"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Neq_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(EQUALITY_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"ltype mismatch rtype"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Ge_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"ltype mismatch rtype"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Gt_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"ltype mismatch rtype"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol And_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(LOGICAL_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Bool"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Or_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(LOGICAL_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Bool"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Xor_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(XOR_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Both lvalue and rvalue should be type Bool"<<endl;
+        t = Bool;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Not_class::checkType(){
+    Symbol ls = e1->checkType();
+    Symbol t;
+    if (!operator_type(NOT_OPERATOR, e1, e1, t)) {
+        semant_error(this)<<"Not class should have Bool type"<<endl;
+        t = ls;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Bitand_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(BITWISE_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Bitand class should have Int type"<<endl;
+        t = Int;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Bitor_class::checkType(){
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(BITWISE_OPERATOR, e1, e2, t)) {
+        semant_error(this)<<"Bitor class should have Int type"<<endl;
+        t = Int;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Bitnot_class::checkType(){
+    Symbol ls = e1->checkType();
+    Symbol t;
+    if (!operator_type(BITNOT_OPERATOR, e1, e1, t)) {
+        semant_error(this)<<"Bitnot class should have Int type"<<endl;
+        t = Int;
+    }
+    this->setType(t);
+    return type;
+}
+
+Symbol Const_int_class::checkType(){
+    setType(Int);
+    return type;
+}
+
+Symbol Const_string_class::checkType(){
+    setType(String);
+    return type;
+}
+
+Symbol Const_float_class::checkType(){
+    setType(Float);
+    return type;
+}
+
+Symbol Const_bool_class::checkType(){
+    setType(Bool);
+    return type;
+}
+
+Symbol Object_class::checkType(){
+    if (objectEnv.lookup(var) == NULL && globalVars[var] == NULL) {
+        semant_error(this)<<"object "<<var<<" has not been defined."<<endl;
+        this->setType(Void);
+        return type;
+    }
+    slot = frame.slot(var);
+    if (localVars[var] != NULL) {
+        Symbol ty = localVars[var];
+        this->setType(ty);
+        return type;
+    }
+    Symbol ty = globalVars[var];
+    this->setType(ty);
+    return type;
+}
+
+Symbol No_expr_class::checkType(){
+    setType(Void);
+    return getType();
+}
+
+// give the tables back when the compilation ends, see Arena
+static void free_tables() {
+    frame.scopes.clear();
+    std::deque<int>().swap(frame.slots);
+    callTable.clear();
+    globalVars.clear();
+    localVars.clear();
+    methodTable.clear();
+    installTable.clear();
+}
+
+void Program_class::semant() {
+    install_signatures(decls);
+    check_calls(decls);
+    halt_on_semant_errors();
+}
+
+//
+// The steps of semant(), for -fsingle-pass to check and code one
+// function at a time (see Program_class::cgen_single_pass).
+//
+
+void install_signatures(Decls decls) {
+    tree_arena.at_release(free_tables);
+    initialize_constants();
+    install_calls(decls);
+    check_main();
+    install_globalVars(decls);
+}
+
+bool check_call(Decl decl) {
+    localVars.clear();
+    decl->check();
+    return semant_errors == 0;
+}
+
+void halt_on_semant_errors() {
+    if (semant_errors > 0) {
+        cerr << "Compilation halted due to static semantic errors." << endl;
+        exit(1);
+    }
+}
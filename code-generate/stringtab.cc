@@ -19,8 +19,34 @@ template class StringTable<StringEntry>;
 template class StringTable<IntEntry>;
 template class StringTable<FloatEntry>;
 
+//
+// The strings of Entrys are carved out of large blocks rather than
+// allocated one by one; the blocks are freed together with the tables
+// by free_string_tables.
+//
+#define ARENA_BLOCK 65536
+
+static std::vector<char *> string_blocks;
+static char *string_next = NULL, *string_end = NULL;
+
+static char *arena_alloc(int size)
+{
+  if (size > ARENA_BLOCK / 4) {
+    string_blocks.push_back(new char[size]);
+    return string_blocks.back();
+  }
+  if (string_end - string_next < size) {
+    string_next = new char[ARENA_BLOCK];
+    string_end = string_next + ARENA_BLOCK;
+    string_blocks.push_back(string_next);
+  }
+  char *p = string_next;
+  string_next += size;
+  return p;
+}
+
 Entry::Entry(char *s, int l, int i) : len(l), index(i) {
-  str = new char [len+1];
+  str = arena_alloc(len+1);
   strncpy(str, s, len);
   str[len] = '\0';
 }
@@ -79,4 +105,16 @@ FloatEntry::FloatEntry(char *s, int l, int i) : Entry(s,l,i) { }
 IdTable idtable;
 IntTable inttable;
 StrTable stringtable;
-FloatTable floattable;
\ No newline at end of file
+FloatTable floattable;
+
+void free_string_tables()
+{
+  idtable.clear();
+  inttable.clear();
+  stringtable.clear();
+  floattable.clear();
+  for (size_t i = 0; i < string_blocks.size(); i++)
+    delete [] string_blocks[i];
+  std::vector<char *>().swap(string_blocks);
+  string_next = string_end = NULL;
+}
@@ -13,6 +13,7 @@
 #include <string.h>
 #include "list.h"    // list template
 #include "seal-io.h"
+#include <vector>
 
 class Entry;
 typedef Entry* Symbol;
@@ -39,6 +40,7 @@ public:
                          
   // is the integer argument equal to the index of this Entry?
   bool equal_index(int ind) const           { return ind == index; }
+  int get_index() const                     { return index; }
 
   ostream& print(ostream& s) const;
 
@@ -100,10 +102,21 @@ template <class Elem>
 class StringTable
 {
 protected:
-   List<Elem> *tbl;   // a string table is a list
+   struct Slot {
+      unsigned hash;
+      int len;
+      Elem *elem;      // NULL for an empty slot
+      Slot(): hash(0), len(0), elem(NULL) { }
+   };
+   std::vector<Elem *> entries;   // the entries, by index
+   std::vector<Slot> slots;   // hash table of the entries
    int index;         // the current index
+
+   static unsigned hash_string(char *s, int len);
+   Slot *find_slot(char *s, int len, unsigned hash);
+   void grow();
 public:
-   StringTable(): tbl((List<Elem> *) NULL), index(0) { }   // an empty table
+   StringTable(): index(0) { }   // an empty table
    // The following methods each add a string to the string table.  
    // Only one copy of each string is maintained.  
    // Returns a pointer to the string table entry with the string.
@@ -123,9 +136,19 @@ public:
    int more(int i);   // are there more indices?
    int next(int i);   // next index
 
+   // The entries in index order, for range-based for loops.
+   typedef typename std::vector<Elem *>::const_iterator iterator;
+   typedef typename std::vector<Elem *>::const_reverse_iterator reverse_iterator;
+   iterator begin() const { return entries.begin(); }
+   iterator end() const { return entries.end(); }
+   reverse_iterator rbegin() const { return entries.rbegin(); }
+   reverse_iterator rend() const { return entries.rend(); }
+
    Elem *lookup(int index);      // lookup an element using its index
    Elem *lookup_string(char *s); // lookup an element using its string
 
+   void clear();  // delete every entry and give back the table's storage
+
    void print();  // print the entire table; for debugging
 
 };
@@ -154,4 +177,7 @@ extern IdTable idtable;
 extern IntTable inttable;
 extern StrTable stringtable;
 extern FloatTable floattable;
+
+// clear the four tables and free the strings of their entries
+void free_string_tables();
 #endif
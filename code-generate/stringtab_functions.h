@@ -12,37 +12,90 @@
 #include <stdio.h>
 
 //
-// A string table is implemented a linked list of Entrys.  Each Entry
-// in the list has a unique string.
+// A string table keeps its Entrys in an open-addressing hash table
+// (linear probing, a power of two in size, at most half full) whose
+// slots hold each string's hash and length, so a probe only compares
+// the characters of a likely match.  The Entrys are also kept in a
+// vector by index, for lookup by index and iteration.
 //
 
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME 16777619u
+
 template <class Elem>
 Elem *StringTable<Elem>::add_string(char *s)
 {
  return add_string(s,MAXSIZE);
 }
 
+template <class Elem>
+unsigned StringTable<Elem>::hash_string(char *s, int len)
+{
+  unsigned h = FNV_OFFSET;
+  for (int i = 0; i < len; i++) {
+    h = (h ^ (unsigned char) s[i]) * FNV_PRIME;
+  }
+  return h;
+}
+
+//
+// The slot holding the string, or the empty slot where it would go.
 //
-// Add a string requires two steps.  First, the list is searched; if the
+template <class Elem>
+typename StringTable<Elem>::Slot *StringTable<Elem>::find_slot(char *s, int len, unsigned hash)
+{
+  unsigned mask = slots.size() - 1;
+  for (unsigned i = hash & mask; ; i = (i + 1) & mask) {
+    Slot *slot = &slots[i];
+    if (slot->elem == NULL ||
+        (slot->hash == hash && slot->len == len && slot->elem->equal_string(s, len))) {
+      return slot;
+    }
+  }
+}
+
+template <class Elem>
+void StringTable<Elem>::grow()
+{
+  std::vector<Slot> old;
+  old.swap(slots);
+  slots.assign(old.empty() ? 64 : old.size() * 2, Slot());
+  for (size_t i = 0; i < old.size(); i++) {
+    if (old[i].elem != NULL) {
+      Elem *e = old[i].elem;
+      *find_slot(e->get_string(), old[i].len, old[i].hash) = old[i];
+    }
+  }
+}
+
+//
+// Add a string requires two steps.  First, the table is searched; if the
 // string is found, a pointer to the existing Entry for that string is 
 // returned.  If the string is not found, a new Entry is created and added
-// to the list.
+// to the table.
 //
 template <class Elem>
 Elem *StringTable<Elem>::add_string(char *s, int maxchars)
 {
   int len = min((int) strlen(s),maxchars);
-  for(List<Elem> *l = tbl; l; l = l->tl())
-    if (l->hd()->equal_string(s,len))
-      return l->hd();
+  if (2 * (index + 1) > (int) slots.size()) {
+    grow();
+  }
+  unsigned hash = hash_string(s, len);
+  Slot *slot = find_slot(s, len, hash);
+  if (slot->elem != NULL)
+    return slot->elem;
 
   Elem *e = new Elem(s,len,index++);
-  tbl = new List<Elem>(e, tbl);
+  slot->hash = hash;
+  slot->len = len;
+  slot->elem = e;
+  entries.push_back(e);
   return e;
 }
 
 //
-// To look up a string, the list is scanned until a matching Entry is located.
+// To look up a string, its slot is found as in add_string.
 // If no such entry is found, an assertion failure occurs.  Thus, this function
 // is used only for strings that one expects to find in the table.
 //
@@ -50,13 +103,29 @@ template <class Elem>
 Elem *StringTable<Elem>::lookup_string(char *s)
 {
   int len = strlen(s);
-  for(List<Elem> *l = tbl; l; l = l->tl())
-    if (l->hd()->equal_string(s,len))
-      return l->hd();
+  if (!slots.empty()) {
+    Slot *slot = find_slot(s, len, hash_string(s, len));
+    if (slot->elem != NULL)
+      return slot->elem;
+  }
   assert(0);   // fail if string is not found
   return NULL; // to avoid compiler warning
 }
 
+//
+// clear deletes the Entrys; their strings are freed with the blocks
+// they were carved from, see free_string_tables.
+//
+template <class Elem>
+void StringTable<Elem>::clear()
+{
+  for (size_t i = 0; i < entries.size(); i++)
+    delete entries[i];
+  std::vector<Elem *>().swap(entries);
+  std::vector<Slot>().swap(slots);
+  index = 0;
+}
+
 //
 // lookup is similar to lookup_string, but uses the index of the string
 // as the key.
@@ -64,15 +133,12 @@ Elem *StringTable<Elem>::lookup_string(char *s)
 template <class Elem>
 Elem *StringTable<Elem>::lookup(int ind)
 {
-  for(List<Elem> *l = tbl; l; l = l->tl())
-    if (l->hd()->equal_index(ind))
-      return l->hd();
-  assert(0);   // fail if string is not found
-  return NULL; // to avoid compiler warning
+  assert(ind >= 0 && ind < index);   // fail if string is not found
+  return entries[ind];
 }
 
 //
-// add_int adds the string representation of an integer to the list.
+// add_int adds the string representation of an integer to the table.
 //
 template <class Elem>
 Elem *StringTable<Elem>::add_int(long i)
@@ -100,8 +166,14 @@ int StringTable<Elem>::next(int i)
   return i+1;
 }
 
+//
+// Prints the entries newest first.
+//
 template <class Elem>
 void StringTable<Elem>::print()
 {
-  list_print(cerr,tbl);
+  cerr << "[\n";
+  for (reverse_iterator e = rbegin(); e != rend(); ++e)
+    cerr << **e << " ";
+  cerr << "]\n";
 }
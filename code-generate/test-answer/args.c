@@ -0,0 +1,31 @@
+/* test/args.seal in C; Seal evaluates actuals left to right */
+#include <stdio.h>
+
+double scale(double x, long long k, int neg)
+{
+    if (neg)
+        return 0.0 - x * k;
+    return x * k;
+}
+
+long long pick(long long a, long long b, long long c, long long d, long long e, long long f)
+{
+    return a * 100000 + b * 10000 + c * 1000 + d * 100 + e * 10 + f;
+}
+
+long long bump(long long x)
+{
+    return x + 1;
+}
+
+int main(void)
+{
+    long long i = 3;
+    double x = 1.25;
+    printf("%lld\n", pick(1, i, bump(i), 4, i * 2 - 1, bump(bump(i))));
+    printf("%.4f %.4f\n", scale(2.5, i, 1), scale(x, 7, 0));
+    printf("%s %lld %.2f %lld\n", "mixed", i, x, pick(i, i, i, i, i, i));
+    i = 9;
+    printf("%lld\n", pick(i, i, 0, 0, 0, 0));
+    return 0;
+}
@@ -0,0 +1,26 @@
+/* test/bitops.seal in C */
+#include <stdio.h>
+
+long long mask;
+double scale;
+int ready;
+
+long long bits(long long x, long long y)
+{
+    return (x | y) & ~(x & y);
+}
+
+int main(void)
+{
+    long long i, acc;
+    mask = 255;
+    scale = 0.5;
+    ready = 1;
+    acc = 0;
+    for (i = 0; i < 20; i = i + 1)
+        acc = acc + ((bits(i, acc) & mask) | 3);
+    printf("%lld\n", acc);
+    if (ready)
+        printf("%.3f\n", scale + 1.25);
+    return 0;
+}
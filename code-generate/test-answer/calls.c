@@ -0,0 +1,35 @@
+/* test/calls.seal in C; Seal evaluates actuals left to right */
+#include <stdio.h>
+
+long long weigh(long long a, double b, long long c, long long d, double e, long long f)
+{
+    return a * 1000 + c * 100 + d * 10 + f;
+}
+
+double half(double x, long long unused)
+{
+    return x / 2.0;
+}
+
+void report(long long n)
+{
+    printf("report %lld\n", n);
+}
+
+long long fib(long long n)
+{
+    if (n < 2)
+        return n;
+    return fib(n - 1) + fib(n - 2);
+}
+
+int main(void)
+{
+    long long i = 4;
+    printf("%lld\n", weigh(1, 0.5, i, fib(i), 2.5, i * 2));
+    printf("%.3f\n", half(7.0, fib(10)));
+    report(fib(15));
+    fib(5);
+    report(weigh(fib(3), 1.0, 0, 0, 2.0, fib(6)));
+    return 0;
+}
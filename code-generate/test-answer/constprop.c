@@ -0,0 +1,47 @@
+/* test/constprop.seal in C; %d prints the low 32 bits of an Int */
+#include <stdio.h>
+
+long long config(long long x)
+{
+    long long n, mode, i, acc;
+    int fast;
+    double scale;
+    n = 10;
+    mode = n * 2 - 15;
+    fast = mode > 3 && n != 0;
+    scale = 1.5 * 2.0;
+    acc = 0;
+    if (n > 5)
+        acc = acc + mode;
+    else
+        acc = acc + x;
+    if (fast)
+        acc = acc + 100;
+    for (i = 0; i < n; i = i + 1) {
+        if (mode == 5)
+            acc = acc + i;
+        else
+            acc = acc - 1000;
+        n = 10;
+    }
+    while (0)
+        acc = 0;
+    i = 3;
+    while (i > 0) {
+        i = i - 1;
+        if (i == 1)
+            continue;
+        acc = acc + x;
+    }
+    if (scale > 2.5)
+        acc = acc + 7;
+    return acc;
+}
+
+int main(void)
+{
+    long long a = config(1);
+    long long b = config(-4);
+    printf("%d %d\n", (int) a, (int) b);
+    return 0;
+}
@@ -0,0 +1,32 @@
+/* test/cse.seal in C; %d prints the low 32 bits of an Int */
+#include <stdio.h>
+
+long long dist(long long x1, long long y1, long long x2, long long y2)
+{
+    long long d, i;
+    d = (x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1);
+    if ((x2 - x1) > 0) {
+        d = d + (x2 - x1);
+    } else {
+        x1 = 0;
+        d = d + (x2 - x1);
+    }
+    d = d + (x2 - x1);
+    for (i = 0; i < 3; i = i + 1) {
+        d = d + (y2 - y1) * i;
+        y1 = y1 + 1;
+        d = d + (y2 - y1);
+    }
+    while ((y2 - y1) > 0)
+        y1 = y1 + (y2 - y1);
+    return d + (y2 - y1);
+}
+
+int main(void)
+{
+    double a = 1.5, b = 2.0;
+    long long p = dist(1, 2, 7, 9);
+    long long q = dist(5, 5, 2, 1);
+    printf("%d %d %f\n", (int) p, (int) q, (a * b) + (b * a) + (a * b));
+    return 0;
+}
@@ -0,0 +1,52 @@
+/* test/deadcode.seal in C */
+#include <stdio.h>
+
+long long pick(long long x)
+{
+    long long t, unused;
+    t = x * 3;
+    unused = t + 7;
+    t = x + 1;
+    x + t;
+    return t;
+}
+
+long long shadow(long long n)
+{
+    long long s, i;
+    s = 100;
+    for (i = 0; i < n; i = i + 1) {
+        long long s;
+        s = i * 2;
+        if (s > 4)
+            break;
+        printf("inner s %lld\n", s);
+    }
+    if (n > 2) {
+        long long s;
+        s = n;
+        printf("shadowing s %lld\n", s);
+    } else {
+        long long s;
+        s = 0 - n;
+        printf("shadowing s %lld\n", s);
+    }
+    return s;
+}
+
+int main(void)
+{
+    long long a, b;
+    a = 1;
+    a = pick(4);
+    b = a;
+    b = shadow(5);
+    printf("%lld %lld\n", a, b);
+    while (1) {
+        a = a + 1;
+        if (a > 8)
+            break;
+    }
+    printf("%lld\n", a);
+    return 0;
+}
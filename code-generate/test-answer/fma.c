@@ -0,0 +1,23 @@
+/* test/fma.seal in C, without contraction into fused multiply-adds */
+#include <stdio.h>
+
+double poly(double x, long long n)
+{
+    double r;
+    r = 1.5 * x + 0.25;
+    r = r * x - 3.0;
+    r = 2.0 - r * x;
+    r = r + n * x;
+    r = r / (x * x + 1.0) + n;
+    return r;
+}
+
+int main(void)
+{
+    long long i;
+    double t = 0.0;
+    for (i = 1; i < 10; i = i + 1)
+        t = t + poly(0.5 * i, i);
+    printf("%.12f\n", t);
+    return 0;
+}
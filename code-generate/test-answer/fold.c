@@ -0,0 +1,51 @@
+/* test/fold.seal in C */
+#include <stdio.h>
+
+long long sum_to(long long n)
+{
+    long long i, s = 0;
+    for (i = 1; i <= n; i = i + 1) {
+        if (i % 3 == 0)
+            continue;
+        s = s + i;
+    }
+    return s;
+}
+
+long long total_to(long long m)
+{
+    long long j, t = 0;
+    for (j = 1; j <= m; j = j + 1) {
+        if (j % 3 == 0)
+            continue;
+        t = t + j;
+    }
+    return t;
+}
+
+long long count_down(long long n)
+{
+    if (n <= 0)
+        return 0;
+    return 1 + count_down(n - 1);
+}
+
+long long steps(long long k)
+{
+    if (k <= 0)
+        return 0;
+    return 1 + steps(k - 1);
+}
+
+double twice(double x)
+{
+    return x + x;
+}
+
+int main(void)
+{
+    printf("%lld %lld\n", sum_to(100), total_to(100));
+    printf("%lld %lld\n", count_down(25), steps(30));
+    printf("%.2f\n", twice(1.75));
+    return 0;
+}
@@ -0,0 +1,37 @@
+/* test/globals.seal in C */
+#include <stdio.h>
+
+long long g;
+int flag;
+
+long long touch(void)
+{
+    g = g * 2;
+    flag = !flag;
+    return 0;
+}
+
+void unused(void)
+{
+    g = 100;
+}
+
+int main(void)
+{
+    long long i, t, u;
+    g = 3;
+    t = g + 1;
+    touch();
+    u = g + 1;
+    printf("%lld %lld %lld\n", t, u, g);
+    for (i = 0; i < 4; i = i + 1) {
+        if (flag)
+            t = t + g;
+        else
+            t = t - 1;
+        touch();
+    }
+    g = 7;
+    printf("%lld %lld\n", t, g);
+    return 0;
+}
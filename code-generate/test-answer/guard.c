@@ -0,0 +1,27 @@
+/* test/guard.seal in C; %d prints the low 32 bits of an Int */
+#include <stdio.h>
+
+long long check(long long x, int done, double f)
+{
+    long long n = 0;
+    if (done || x > 10)
+        n = n + 1;
+    if (!done && x % 3 == 0)
+        n = n + 10;
+    if ((x >= 5 && x <= 15) || (f < 0.5 && !(x == 7)))
+        n = n + 100;
+    while (n < 1000 && !(x != 4))
+        n = n + 400;
+    return n;
+}
+
+int main(void)
+{
+    long long i, t = 0;
+    for (i = 0; i < 20; i = i + 1) {
+        t = t * 3 + check(i, i % 4 == 0, 0.1 * i);
+        t = t % 1000003;
+    }
+    printf("%d\n", (int) t);
+    return 0;
+}
@@ -0,0 +1,55 @@
+/* test/layout.seal in C; %d prints the low 32 bits of an Int */
+#include <stdio.h>
+
+long long classify(long long x)
+{
+    if (x == 0) {
+        printf("zero\n");
+        return 0;
+    }
+    if (x < 0)
+        return -1;
+    return 1;
+}
+
+long long search(long long limit, long long target)
+{
+    long long i, j, found = -1;
+    for (i = 0; i < limit; i = i + 1) {
+        j = 0;
+        while (j < limit) {
+            j = j + 1;
+            if (j % 2 == 0)
+                continue;
+            if (i * j == target) {
+                found = i * 100 + j;
+                break;
+            }
+        }
+        if (found != -1)
+            break;
+    }
+    return found;
+}
+
+int main(void)
+{
+    long long i, t = 0, a, b, c;
+    for (i = -3; i < 4; i = i + 1)
+        t = t * 3 + classify(i);
+    printf("%d\n", (int) t);
+    a = search(10, 21);
+    b = search(10, 4);
+    c = search(5, 49);
+    printf("%d %d %d\n", (int) a, (int) b, (int) c);
+    i = 0;
+    while (i < 100) {
+        i = i + 7;
+        if (i == 49)
+            printf("%d\n", (int) i);
+        else
+            t = t + i;
+    }
+    printf("%d\n", (int) t);
+    return 0;
+}
@@ -0,0 +1,39 @@
+/* test/manyargs.seal in C; Seal evaluates actuals left to right */
+#include <stdio.h>
+
+long long ints(long long a, long long b, long long c, long long d, long long e, long long f, long long g,
+               long long h, long long i, long long j, long long k, long long l, long long m)
+{
+    return a + 2 * b + 3 * c + 4 * d + 5 * e + 6 * f + 7 * g + 8 * h + 9 * i + 10 * j + 11 * k + 12 * m;
+}
+
+double floats(double f0, double f1, double f2, double f3, double f4, double f5, double f6, double f7,
+              double f8, double f9, double f10, double f11, double f12, double f13, double f14, double f15,
+              double f16, double f17, double dead)
+{
+    return f0 + f1 + f2 + f3 + f4 + f5 + f6 + f7 + f8 + f9 + f10 + f11 + f12 + f13 + f14 + f15 + f16 * 10.0 + f17 * 100.0;
+}
+
+long long mixed(long long a, double x, long long b, double y, long long c, double z, long long d, double w,
+                long long e, long long unused, long long f, long long g, long long h, long long i, long long j,
+                long long k, int flag)
+{
+    if (flag)
+        printf("%.3f\n", x + y + z + w);
+    return a + b + c + d + e + f + g + h + i + j + k;
+}
+
+long long count(long long n)
+{
+    printf("count %lld\n", n);
+    return n;
+}
+
+int main(void)
+{
+    printf("%lld\n", ints(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, count(12), 13));
+    printf("%.3f\n", floats(0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0, 5.5, 6.0, 6.5, 7.0, 7.5, 8.0, 8.5, 9.0, 1000.0));
+    printf("%lld\n", mixed(1, 0.25, 2, 0.5, 3, 0.75, 4, 1.0, 5, count(6), 7, 8, 9, 10, 11, 12, 1));
+    printf("%lld\n", mixed(1, 0.25, 2, 0.5, 3, 0.75, 4, 1.0, 5, 6, 7, 8, 9, 10, 11, 12, 0));
+    return 0;
+}
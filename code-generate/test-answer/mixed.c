@@ -0,0 +1,40 @@
+/* test/mixed.seal in C: an Int meeting a Float is converted to Float */
+#include <stdio.h>
+
+double g0;
+long long n;
+
+double scale(long long p)
+{
+    double v1;
+    v1 = (3 - p) * (g0 - 2.0);
+    return v1;
+}
+
+double blend(double x, long long k)
+{
+    double r;
+    r = x / k + k * 0.25 - (k - x);
+    if (k < x)
+        r = r + 1;
+    if (x >= k + 0.5)
+        r = r * 2;
+    return r;
+}
+
+int main(void)
+{
+    long long i;
+    double acc;
+    g0 = 4.5;
+    n = 7;
+    acc = 0.0;
+    for (i = 0; i < n; i = i + 1) {
+        acc = acc + scale(i) + blend(acc, i + 1);
+        if (acc > 100)
+            acc = acc / n;
+        printf("%lld %.4f\n", i, acc);
+    }
+    printf("%.4f %.4f\n", -(n * g0), n / 2.0 - n % 2);
+    return 0;
+}
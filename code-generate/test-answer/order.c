@@ -0,0 +1,26 @@
+/* test/order.seal in C */
+#include <stdio.h>
+
+long long mix(long long a, long long b, long long c, long long d)
+{
+    return a - (b * (c - d) + (a & c) * (b | d)) / (1 + (d & 7));
+}
+
+double poly(double x, double y)
+{
+    return x * x - (y - x * (y + 2.5)) / (x + y * y + 1.0);
+}
+
+int main(void)
+{
+    long long i, acc = 0;
+    double f = 0.0;
+    for (i = 0; i < 5000; i = i + 1) {
+        acc = acc + mix(i, i % 13, i % 7 + 3, 5) % 1000;
+        if (i % 1000 == 0)
+            f = f + poly(i / 1000 + 0.5, 2.0);
+    }
+    printf("%lld %.6f\n", acc, f);
+    printf("%lld\n", (acc % 17) - ((acc % 5) * ((acc % 3) - (acc % 11))));
+    return 0;
+}
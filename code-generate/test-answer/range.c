@@ -0,0 +1,34 @@
+/* test/range.seal in C */
+#include <stdio.h>
+
+long long digits(long long n)
+{
+    long long count = 0, d;
+    if (n < 0)
+        n = 0 - n;
+    while (n > 0) {
+        d = n % 10;
+        count = count + d;
+        n = n / 10;
+    }
+    return count;
+}
+
+int main(void)
+{
+    long long i, h = 0, neg, big;
+    for (i = 0; i < 1000; i = i + 1) {
+        h = (h * 31 + i % 97) % 1000003;
+        if (i % 8 == 3)
+            h = h + i / 4;
+    }
+    printf("%lld\n", h);
+    neg = 0;
+    for (i = 0 - 50; i < 50; i = i + 7)
+        neg = neg + i % 6 + i / 5;
+    printf("%lld\n", neg);
+    big = 5000000000LL;
+    printf("%lld %lld\n", big % 7, big / 3);
+    printf("%lld %lld\n", digits(1234567), digits(0 - 98765));
+    return 0;
+}
@@ -0,0 +1,32 @@
+/* test/sched.seal in C; %d prints the low 32 bits of an Int */
+#include <stdio.h>
+
+double dot(double x1, double y1, double x2, double y2)
+{
+    return x1 * x2 + y1 * y2;
+}
+
+double slope(double x1, double y1, double x2, double y2)
+{
+    return (y2 - y1) / (x2 - x1);
+}
+
+long long mix(long long a, long long b, long long c)
+{
+    long long s;
+    s = (a * b + c * 7) - (a - b) * (c + 3);
+    s = s + a / 3 + b % 5;
+    return s;
+}
+
+int main(void)
+{
+    long long i, n = 0;
+    double t = 0.0;
+    for (i = 1; i < 20; i = i + 1) {
+        t = t + dot(1.5 * i, 2.0, 0.5, 0.25 * i) - slope(1.0, 2.0, 1.0 + i, 3.5);
+        n = n + mix(i, i + 2, i * 3);
+    }
+    printf("%f %d\n", t, (int) n);
+    return 0;
+}
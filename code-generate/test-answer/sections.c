@@ -0,0 +1,41 @@
+/* test/sections.seal in C; Seal evaluates actuals left to right */
+#include <stdio.h>
+
+long long leaf(long long x)
+{
+    return x * 3 + 1;
+}
+
+long long unused(long long x)
+{
+    return leaf(x) * 1000;
+}
+
+long long rare(long long x)
+{
+    printf("rare %lld\n", x);
+    return x;
+}
+
+long long step(long long x)
+{
+    if (x % 64 == 63)
+        return rare(x);
+    return leaf(x) % 97;
+}
+
+long long walk(long long n)
+{
+    if (n < 1)
+        return 0;
+    return step(n) + walk(n - 1);
+}
+
+int main(void)
+{
+    long long i, sum = 0;
+    for (i = 0; i < 200; i = i + 1)
+        sum = sum + step(i);
+    printf("%lld %lld\n", sum, walk(20));
+    return 0;
+}
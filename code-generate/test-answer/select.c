@@ -0,0 +1,49 @@
+/* test/select.seal in C; %d prints the low 32 bits of an Int, and
+   fmin is renamed to stay clear of the C library's */
+#include <stdio.h>
+
+long long max(long long a, long long b)
+{
+    long long m;
+    if (a > b)
+        m = a;
+    else
+        m = b;
+    return m;
+}
+
+long long clamp(long long v, long long lo, long long hi)
+{
+    if (v > hi)
+        v = hi;
+    if (v < lo)
+        v = lo;
+    return v;
+}
+
+double float_min(double a, double b)
+{
+    double m;
+    if (a < b)
+        m = a;
+    else
+        m = b;
+    return m;
+}
+
+int main(void)
+{
+    long long i, s = 0;
+    int pos;
+    for (i = -5; i < 15; i = i + 1) {
+        s = s + max(i, 3) * 100 + clamp(i, 0, 9);
+        if (i >= 0)
+            pos = 1;
+        else
+            pos = 0;
+        if (pos)
+            s = s + 1;
+    }
+    printf("%d %f %f\n", (int) s, float_min(1.5, 0.5 - 2.75), float_min(3.0, 4.0));
+    return 0;
+}
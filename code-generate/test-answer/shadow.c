@@ -0,0 +1,15 @@
+/* test/shadow.seal in C */
+#include <stdio.h>
+
+int main(void)
+{
+    long long v3 = 100;
+    if (v3 < 7) {
+        printf("small %lld\n", v3);
+    } else {
+        long long v3 = 5;
+        printf("inner %lld\n", v3);
+    }
+    printf("outer %lld\n", v3);
+    return 0;
+}
@@ -0,0 +1,27 @@
+/* test/unswitch.seal in C */
+#include <stdio.h>
+
+long long sum(long long n, int fast, long long k)
+{
+    long long i, s = 0;
+    for (i = 0; i < n; i = i + 1) {
+        if (fast)
+            s = s + i;
+        else
+            s = s + 2 * i;
+        if (k > 3)
+            s = s + 1;
+    }
+    while (n > 0) {
+        if (fast)
+            s = s - 1;
+        n = n - 1;
+    }
+    return s;
+}
+
+int main(void)
+{
+    printf("%lld %lld %lld %lld\n", sum(10, 1, 1), sum(10, 0, 5), sum(7, 1, 9), sum(0, 0, 0));
+    return 0;
+}
@@ -0,0 +1,398 @@
+# start of generated code
+	.section		.rodata	
+.LC3:
+	.string	"mixed"
+.LC2:
+	.string	"%s %lld %.2f %lld\n"
+.LC1:
+	.string	"%.4f %.4f\n"
+.LC0:
+	.string	"%lld\n"
+	.text	
+	.globl	scale
+	.type	scale, @function
+scale:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rdi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	$0x0, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movq	-72(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -96(%rbp)
+	subq	$8, %rsp
+	movsd	-88(%rbp), %xmm4
+	movsd	-96(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -104(%rbp)
+	movsd	-104(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	jmp	 .POS1
+.POS0:
+.POS1:
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movq	-72(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	movsd	-112(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	scale, .-scale
+	.globl	pick
+	.type	pick, @function
+pick:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	%rcx, -88(%rbp)
+	subq	$8, %rsp
+	movq	%r8, -96(%rbp)
+	subq	$8, %rsp
+	movq	%r9, -104(%rbp)
+	subq	$8, %rsp
+	movq	$100000, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-112(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -120(%rbp)
+	subq	$8, %rsp
+	movq	$10000, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	subq	$8, %rsp
+	movq	-120(%rbp), %rbx
+	movq	-136(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	subq	$8, %rsp
+	movq	-144(%rbp), %rbx
+	movq	-160(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -168(%rbp)
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-176(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -184(%rbp)
+	subq	$8, %rsp
+	movq	-168(%rbp), %rbx
+	movq	-184(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -192(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-200(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -208(%rbp)
+	subq	$8, %rsp
+	movq	-192(%rbp), %rbx
+	movq	-208(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -216(%rbp)
+	subq	$8, %rsp
+	movq	-216(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -224(%rbp)
+	movq	-224(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	pick, .-pick
+	.globl	bump
+	.type	bump, @function
+bump:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -80(%rbp)
+	movq	-80(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	bump, .-bump
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff4000000000000, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -40(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -48(%rbp)
+	movq	-8(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 bump
+	subq	$8, %rsp
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -80(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-8(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 bump
+	subq	$8, %rsp
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 bump
+	subq	$8, %rsp
+	movq	%rax, -112(%rbp)
+	movq	-48(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	movq	-56(%rbp), %rdx
+	movq	-64(%rbp), %rcx
+	movq	-96(%rbp), %r8
+	movq	-112(%rbp), %r9
+	andq	$-16, %rsp
+	call	 pick
+	subq	$8, %rsp
+	movq	%rax, -120(%rbp)
+	movq	-40(%rbp), %rdi
+	movq	-120(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	$0x4004000000000000, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -152(%rbp)
+	movsd	-144(%rbp), %xmm0
+	movq	-8(%rbp), %rdi
+	movq	-152(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 scale
+	subq	$8, %rsp
+	movsd	%xmm0, -160(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -176(%rbp)
+	movsd	-16(%rbp), %xmm0
+	movq	-168(%rbp), %rdi
+	movq	-176(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 scale
+	subq	$8, %rsp
+	movsd	%xmm0, -184(%rbp)
+	movq	-136(%rbp), %rdi
+	movsd	-160(%rbp), %xmm0
+	movsd	-184(%rbp), %xmm1
+	subq	$8, %rsp
+	movl	$2, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC2, %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	$.LC3, %rax
+	movq	%rax, -208(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	movq	-8(%rbp), %rdx
+	movq	-8(%rbp), %rcx
+	movq	-8(%rbp), %r8
+	movq	-8(%rbp), %r9
+	andq	$-16, %rsp
+	call	 pick
+	subq	$8, %rsp
+	movq	%rax, -216(%rbp)
+	movq	-200(%rbp), %rdi
+	movq	-208(%rbp), %rsi
+	movq	-8(%rbp), %rdx
+	movsd	-16(%rbp), %xmm0
+	movq	-216(%rbp), %rcx
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movq	$9, %rax
+	movq	%rax, -240(%rbp)
+	movq	-240(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -248(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -256(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -264(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -272(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	movq	-248(%rbp), %rdx
+	movq	-256(%rbp), %rcx
+	movq	-264(%rbp), %r8
+	movq	-272(%rbp), %r9
+	andq	$-16, %rsp
+	call	 pick
+	subq	$8, %rsp
+	movq	%rax, -280(%rbp)
+	movq	-232(%rbp), %rdi
+	movq	-280(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,228 @@
+# start of generated code
+	.data	
+	.globl	mask
+	.align	8
+	.type	mask, @object
+	.size	mask, 8
+mask:
+	.quad	0
+	.globl	scale
+	.align	8
+	.type	scale, @object
+	.size	scale, 8
+scale:
+	.long	0
+	.long	0
+	.globl	ready
+	.align	8
+	.type	ready, @object
+	.size	ready, 8
+ready:
+	.long	0
+	.section		.rodata	
+.LC1:
+	.string	"%.3f\n"
+.LC0:
+	.string	"%lld\n"
+	.text	
+	.globl	bits
+	.type	bits, @function
+bits:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	orq	%rax, %rdx
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -88(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rax
+	notq	 %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-96(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -104(%rbp)
+	movq	-104(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	bits, .-bits
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$255, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, mask(%rip)
+	subq	$8, %rsp
+	movq	%rax, -32(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, scale(%rip)
+	subq	$8, %rsp
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -56(%rbp)
+	movq	-56(%rbp), %rax
+	movq	%rax, ready(%rip)
+	subq	$8, %rsp
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -72(%rbp)
+	movq	-72(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	$20, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -96(%rbp)
+	movq	-96(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	movq	-8(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 bits
+	subq	$8, %rsp
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	mask(%rip), %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	movq	-112(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -120(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-120(%rbp), %rax
+	movq	-128(%rbp), %rdx
+	orq	%rax, %rdx
+	movq	%rdx, -136(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-136(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	movq	-144(%rbp), %rax
+	movq	%rax, -16(%rbp)
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS0
+.POS2:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -168(%rbp)
+	movq	-168(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	ready(%rip), %rax
+	movq	%rax, -184(%rbp)
+	movq	-184(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	scale(%rip), %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff4000000000000, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movsd	-200(%rbp), %xmm4
+	movsd	-208(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -216(%rbp)
+	movq	-192(%rbp), %rdi
+	movsd	-216(%rbp), %xmm0
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	jmp	 .POS6
+.POS5:
+.POS6:
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,394 @@
+# start of generated code
+	.section		.rodata	
+.LC2:
+	.string	"%.3f\n"
+.LC1:
+	.string	"%lld\n"
+.LC0:
+	.string	"report %lld\n"
+	.text	
+	.globl	weigh
+	.type	weigh, @function
+weigh:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%xmm0, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -80(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -88(%rbp)
+	subq	$8, %rsp
+	movq	%xmm1, -96(%rbp)
+	subq	$8, %rsp
+	movq	%rcx, -104(%rbp)
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-112(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -120(%rbp)
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	subq	$8, %rsp
+	movq	-120(%rbp), %rbx
+	movq	-136(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	subq	$8, %rsp
+	movq	-144(%rbp), %rbx
+	movq	-160(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -168(%rbp)
+	subq	$8, %rsp
+	movq	-168(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -176(%rbp)
+	movq	-176(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	weigh, .-weigh
+	.globl	half
+	.type	half, @function
+half:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rdi, -72(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movsd	-80(%rbp), %xmm5
+	divsd	%xmm5, %xmm4
+	movsd	%xmm4, -88(%rbp)
+	movsd	-88(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	half, .-half
+	.globl	report
+	.type	report, @function
+report:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -72(%rbp)
+	movq	-72(%rbp), %rdi
+	movq	-64(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	report, .-report
+	.globl	fib
+	.type	fib, @function
+fib:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	movq	-64(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	jmp	 .POS1
+.POS0:
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-96(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-112(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -120(%rbp)
+	movq	-120(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	movq	-136(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	fib, .-fib
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -16(%rbp)
+	movq	-16(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -32(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -40(%rbp)
+	movq	-8(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	$0x4004000000000000, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -72(%rbp)
+	movq	-32(%rbp), %rdi
+	movsd	-40(%rbp), %xmm0
+	movq	-8(%rbp), %rsi
+	movq	-48(%rbp), %rdx
+	movsd	-56(%rbp), %xmm1
+	movq	-72(%rbp), %rcx
+	andq	$-16, %rsp
+	call	 weigh
+	subq	$8, %rsp
+	movq	%rax, -80(%rbp)
+	movq	-24(%rbp), %rdi
+	movq	-80(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC2, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0x401c000000000000, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -112(%rbp)
+	movq	-112(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -120(%rbp)
+	movsd	-104(%rbp), %xmm0
+	movq	-120(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 half
+	subq	$8, %rsp
+	movsd	%xmm0, -128(%rbp)
+	movq	-96(%rbp), %rdi
+	movsd	-128(%rbp), %xmm0
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$15, %rax
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -152(%rbp)
+	movq	-152(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 report
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -160(%rbp)
+	movq	-160(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -176(%rbp)
+	movq	-176(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -216(%rbp)
+	subq	$8, %rsp
+	movq	$6, %rax
+	movq	%rax, -224(%rbp)
+	movq	-224(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 fib
+	subq	$8, %rsp
+	movq	%rax, -232(%rbp)
+	movq	-184(%rbp), %rdi
+	movsd	-192(%rbp), %xmm0
+	movq	-200(%rbp), %rsi
+	movq	-208(%rbp), %rdx
+	movsd	-216(%rbp), %xmm1
+	movq	-232(%rbp), %rcx
+	andq	$-16, %rsp
+	call	 weigh
+	subq	$8, %rsp
+	movq	%rax, -240(%rbp)
+	movq	-240(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 report
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
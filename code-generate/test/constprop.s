@@ -0,0 +1,403 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%d %d\n"
+	.text	
+	.globl	config
+	.type	config, @function
+config:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -120(%rbp)
+	movq	-120(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	subq	$8, %rsp
+	movq	$15, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	-136(%rbp), %rbx
+	movq	-144(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -152(%rbp)
+	movq	-152(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-160(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS0
+	movq	$0, %rax
+	jmp	 .POS1
+.POS0:
+	movq	$1, %rax
+.POS1:
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	-176(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jne	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	-168(%rbp), %rax
+	movq	-184(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -192(%rbp)
+	movq	-192(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff8000000000000, %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movsd	-200(%rbp), %xmm4
+	movsd	-208(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -216(%rbp)
+	movq	-216(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -224(%rbp)
+	movq	-224(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	-232(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS6
+	movq	$0, %rax
+	jmp	 .POS7
+.POS6:
+	movq	$1, %rax
+.POS7:
+	movq	%rax, -240(%rbp)
+	movq	-240(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS4
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-80(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -248(%rbp)
+	movq	-248(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	jmp	 .POS5
+.POS4:
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -256(%rbp)
+	movq	-256(%rbp), %rax
+	movq	%rax, -112(%rbp)
+.POS5:
+	movq	-88(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS8
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -264(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-264(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -272(%rbp)
+	movq	-272(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	jmp	 .POS9
+.POS8:
+.POS9:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -280(%rbp)
+	movq	-280(%rbp), %rax
+	movq	%rax, -104(%rbp)
+.POS10:
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS13
+	movq	$0, %rax
+	jmp	 .POS14
+.POS13:
+	movq	$1, %rax
+.POS14:
+	movq	%rax, -288(%rbp)
+	movq	-288(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS12
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -296(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-296(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS17
+	movq	$0, %rax
+	jmp	 .POS18
+.POS17:
+	movq	$1, %rax
+.POS18:
+	movq	%rax, -304(%rbp)
+	movq	-304(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS15
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -312(%rbp)
+	movq	-312(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	jmp	 .POS16
+.POS15:
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -320(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-320(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -328(%rbp)
+	movq	-328(%rbp), %rax
+	movq	%rax, -112(%rbp)
+.POS16:
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -336(%rbp)
+	movq	-336(%rbp), %rax
+	movq	%rax, -72(%rbp)
+.POS11:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -344(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rbx
+	movq	-344(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -352(%rbp)
+	movq	-352(%rbp), %rax
+	movq	%rax, -104(%rbp)
+	jmp	 .POS10
+.POS12:
+.POS19:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -360(%rbp)
+	movq	-360(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS20
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -368(%rbp)
+	movq	-368(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	jmp	 .POS19
+.POS20:
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -376(%rbp)
+	movq	-376(%rbp), %rax
+	movq	%rax, -104(%rbp)
+.POS21:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -384(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	movq	-384(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS23
+	movq	$0, %rax
+	jmp	 .POS24
+.POS23:
+	movq	$1, %rax
+.POS24:
+	movq	%rax, -392(%rbp)
+	movq	-392(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS22
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -400(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rbx
+	movq	-400(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -408(%rbp)
+	movq	-408(%rbp), %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -416(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	movq	-416(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS27
+	movq	$0, %rax
+	jmp	 .POS28
+.POS27:
+	movq	$1, %rax
+.POS28:
+	movq	%rax, -424(%rbp)
+	movq	-424(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS25
+	jmp	 .POS21
+	jmp	 .POS26
+.POS25:
+.POS26:
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -432(%rbp)
+	movq	-432(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	jmp	 .POS21
+.POS22:
+	subq	$8, %rsp
+	movq	$0x4004000000000000, %rax
+	movq	%rax, -440(%rbp)
+	subq	$8, %rsp
+	movsd	-96(%rbp), %xmm0
+	movsd	-440(%rbp), %xmm1
+	ucomisd	%xmm1, %xmm0
+	ja	 .POS31
+	movq	$0, %rax
+	jmp	 .POS32
+.POS31:
+	movq	$1, %rax
+.POS32:
+	movq	%rax, -448(%rbp)
+	movq	-448(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS29
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -456(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-456(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -464(%rbp)
+	movq	-464(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	jmp	 .POS30
+.POS29:
+.POS30:
+	movq	-112(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	subq	$8, %rsp
+	movq	$99, %rax
+	movq	%rax, -472(%rbp)
+	movq	-472(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	.size	config, .-config
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -16(%rbp)
+	movq	-16(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 config
+	subq	$8, %rsp
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -32(%rbp)
+	subq	$8, %rsp
+	movq	-32(%rbp), %rax
+	negq	%rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 config
+	subq	$8, %rsp
+	movq	%rax, -48(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-24(%rbp), %rsi
+	movq	-48(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,375 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%d %d %f\n"
+	.text	
+	.globl	dist
+	.type	dist, @function
+dist:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	%rcx, -88(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -120(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	subq	$8, %rsp
+	movq	-136(%rbp), %rbx
+	movq	-144(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -152(%rbp)
+	subq	$8, %rsp
+	movq	-128(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -168(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-168(%rbp), %rax
+	movq	-176(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -184(%rbp)
+	movq	-184(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -192(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-192(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -200(%rbp)
+	movq	-200(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	jmp	 .POS1
+.POS0:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -208(%rbp)
+	movq	-208(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -216(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-216(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -224(%rbp)
+	movq	-224(%rbp), %rax
+	movq	%rax, -96(%rbp)
+.POS1:
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -232(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-232(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -240(%rbp)
+	movq	-240(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -248(%rbp)
+	movq	-248(%rbp), %rax
+	movq	%rax, -104(%rbp)
+.POS4:
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -256(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	movq	-256(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS7
+	movq	$0, %rax
+	jmp	 .POS8
+.POS7:
+	movq	$1, %rax
+.POS8:
+	movq	%rax, -264(%rbp)
+	movq	-264(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS6
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -272(%rbp)
+	subq	$8, %rsp
+	movq	-272(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -280(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-280(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -288(%rbp)
+	movq	-288(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -296(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-296(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -304(%rbp)
+	movq	-304(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -312(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-312(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -320(%rbp)
+	movq	-320(%rbp), %rax
+	movq	%rax, -96(%rbp)
+.POS5:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -328(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rbx
+	movq	-328(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -336(%rbp)
+	movq	-336(%rbp), %rax
+	movq	%rax, -104(%rbp)
+	jmp	 .POS4
+.POS6:
+.POS9:
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -344(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -352(%rbp)
+	subq	$8, %rsp
+	movq	-344(%rbp), %rax
+	movq	-352(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS11
+	movq	$0, %rax
+	jmp	 .POS12
+.POS11:
+	movq	$1, %rax
+.POS12:
+	movq	%rax, -360(%rbp)
+	movq	-360(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS10
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -368(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-368(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -376(%rbp)
+	movq	-376(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	jmp	 .POS9
+.POS10:
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -384(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-384(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -392(%rbp)
+	movq	-392(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	dist, .-dist
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0x3ff8000000000000, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -40(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	$9, %rax
+	movq	%rax, -72(%rbp)
+	movq	-48(%rbp), %rdi
+	movq	-56(%rbp), %rsi
+	movq	-64(%rbp), %rdx
+	movq	-72(%rbp), %rcx
+	andq	$-16, %rsp
+	call	 dist
+	subq	$8, %rsp
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -112(%rbp)
+	movq	-88(%rbp), %rdi
+	movq	-96(%rbp), %rsi
+	movq	-104(%rbp), %rdx
+	movq	-112(%rbp), %rcx
+	andq	$-16, %rsp
+	call	 dist
+	subq	$8, %rsp
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movsd	-8(%rbp), %xmm4
+	movsd	-16(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -128(%rbp)
+	subq	$8, %rsp
+	movsd	-16(%rbp), %xmm4
+	movsd	-8(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -136(%rbp)
+	subq	$8, %rsp
+	movsd	-128(%rbp), %xmm4
+	movsd	-136(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -144(%rbp)
+	subq	$8, %rsp
+	movsd	-8(%rbp), %xmm4
+	movsd	-16(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -152(%rbp)
+	subq	$8, %rsp
+	movsd	-144(%rbp), %xmm4
+	movsd	-152(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -160(%rbp)
+	movq	-40(%rbp), %rdi
+	movq	-80(%rbp), %rsi
+	movq	-120(%rbp), %rdx
+	movsd	-160(%rbp), %xmm0
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,374 @@
+# start of generated code
+	.section		.rodata	
+.LC5:
+	.string	"%lld\n"
+.LC4:
+	.string	"skipped\n"
+.LC3:
+	.string	"%lld %lld\n"
+.LC2:
+	.string	"shadowing s %lld\n"
+.LC1:
+	.string	"inner s %lld\n"
+.LC0:
+	.string	"never printed\n"
+	.text	
+	.globl	pick
+	.type	pick, @function
+pick:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	movq	-112(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	subq	$8, %rsp
+	movq	$99, %rax
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -152(%rbp)
+	movq	-152(%rbp), %rdi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	.size	pick, .-pick
+	.globl	shadow
+	.type	shadow, @function
+shadow:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -80(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rax
+	movq	-136(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS7
+	movq	$0, %rax
+	jmp	 .POS8
+.POS7:
+	movq	$1, %rax
+.POS8:
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	jmp	 .POS2
+	jmp	 .POS6
+.POS5:
+.POS6:
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -152(%rbp)
+	movq	-152(%rbp), %rdi
+	movq	-112(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-168(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -176(%rbp)
+	movq	-176(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	jmp	 .POS0
+.POS2:
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-184(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS11
+	movq	$0, %rax
+	jmp	 .POS12
+.POS11:
+	movq	$1, %rax
+.POS12:
+	movq	%rax, -192(%rbp)
+	movq	-192(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS9
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	$.LC2, %rax
+	movq	%rax, -208(%rbp)
+	movq	-208(%rbp), %rdi
+	movq	-200(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	jmp	 .POS10
+.POS9:
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movq	-232(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -240(%rbp)
+	movq	-240(%rbp), %rax
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	$.LC2, %rax
+	movq	%rax, -248(%rbp)
+	movq	-248(%rbp), %rdi
+	movq	-224(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+.POS10:
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	shadow, .-shadow
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 pick
+	subq	$8, %rsp
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	movq	-8(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -48(%rbp)
+	movq	-48(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 shadow
+	subq	$8, %rsp
+	movq	%rax, -56(%rbp)
+	movq	-56(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$.LC3, %rax
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	movq	-16(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+.POS13:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS14
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$8, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-104(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS17
+	movq	$0, %rax
+	jmp	 .POS18
+.POS17:
+	movq	$1, %rax
+.POS18:
+	movq	%rax, -112(%rbp)
+	movq	-112(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS15
+	jmp	 .POS14
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -120(%rbp)
+	movq	-120(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS16
+.POS15:
+.POS16:
+	jmp	 .POS13
+	subq	$8, %rsp
+	movq	$.LC4, %rax
+	movq	%rax, -128(%rbp)
+	movq	-128(%rbp), %rdi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	jmp	 .POS13
+.POS14:
+	subq	$8, %rsp
+	movq	$.LC5, %rax
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,145 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%.12f\n"
+	.text	
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$24, %rsp
+	movq	$0x0, %r9
+	movq	$1, -64(%rbp)
+	movq	%r9, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	jmp	 .POS0
+.POS3:
+	movq	-64(%rbp), %rbx
+	movq	$0x3fe0000000000000, %rax
+	movq	-64(%rbp), %rdi
+	movq	%rax, -80(%rbp)
+	vmovsd	-80(%rbp), %xmm4
+	vcvtsi2sdq	%rbx, %xmm5, %xmm5
+	vmulsd	%xmm5, %xmm4, %xmm4
+	vmovsd	%xmm4, -80(%rbp)
+	movsd	-80(%rbp), %xmm0
+	call	 poly
+	vmovsd	-72(%rbp), %xmm4
+	movsd	%xmm0, -80(%rbp)
+	vaddsd	-80(%rbp), %xmm4, %xmm4
+	vmovsd	%xmm4, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, -72(%rbp)
+.POS1:
+	movq	-64(%rbp), %rbx
+	addq	$1, %rbx
+	movq	%rbx, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, -64(%rbp)
+.POS0:
+	movq	-64(%rbp), %rax
+	cmpq	$10, %rax
+	jl	 .POS3
+.POS2:
+	movsd	-72(%rbp), %xmm0
+	movq	$.LC0, %rdi
+	movl	$1, %eax
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+	.globl	poly
+	.type	poly, @function
+poly:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$40, %rsp
+	movq	$0x3ff8000000000000, %r9
+	movq	$0x3fd0000000000000, %r8
+	movq	%xmm0, -64(%rbp)
+	movq	$0x4008000000000000, %rcx
+	movq	%r9, -88(%rbp)
+	vmovsd	-64(%rbp), %xmm5
+	movq	%r8, -96(%rbp)
+	vmovsd	-88(%rbp), %xmm2
+	vmovsd	-96(%rbp), %xmm1
+	movq	$0x4000000000000000, %r8
+	movq	%rdi, -72(%rbp)
+	movq	-72(%rbp), %rbx
+	vfmadd231sd	-64(%rbp), %xmm2, %xmm1
+	vmovsd	%xmm1, -88(%rbp)
+	movq	-88(%rbp), %rsi
+	movq	%rcx, -88(%rbp)
+	vmovsd	-88(%rbp), %xmm3
+	movq	-72(%rbp), %rcx
+	movq	%rsi, -80(%rbp)
+	vmovsd	-80(%rbp), %xmm6
+	vfmsub231sd	-64(%rbp), %xmm6, %xmm3
+	vmovsd	%xmm3, -88(%rbp)
+	movq	-88(%rbp), %r9
+	movq	%r8, -88(%rbp)
+	vmovsd	-88(%rbp), %xmm7
+	movq	$0x3ff0000000000000, %r8
+	movq	%r9, -80(%rbp)
+	vmovsd	-80(%rbp), %xmm8
+	vfnmadd231sd	-64(%rbp), %xmm8, %xmm7
+	vmovsd	%xmm7, -88(%rbp)
+	vcvtsi2sdq	%rcx, %xmm7, %xmm7
+	movq	-88(%rbp), %rsi
+	vmulsd	-64(%rbp), %xmm7, %xmm7
+	movq	%rsi, -80(%rbp)
+	vmovsd	-80(%rbp), %xmm9
+	vmovsd	%xmm7, -88(%rbp)
+	vaddsd	-88(%rbp), %xmm9, %xmm9
+	vmovsd	%xmm9, -88(%rbp)
+	movq	-88(%rbp), %r9
+	movq	%r8, -88(%rbp)
+	vmovsd	-88(%rbp), %xmm10
+	movq	%r9, -80(%rbp)
+	vmovsd	-80(%rbp), %xmm11
+	vfmadd231sd	-64(%rbp), %xmm5, %xmm10
+	vcvtsi2sdq	%rbx, %xmm5, %xmm5
+	vmovsd	%xmm10, -88(%rbp)
+	vdivsd	-88(%rbp), %xmm11, %xmm11
+	vmovsd	%xmm11, -88(%rbp)
+	vmovsd	-88(%rbp), %xmm4
+	vaddsd	%xmm5, %xmm4, %xmm4
+	vmovsd	%xmm4, -88(%rbp)
+	movq	-88(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	movsd	-80(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	poly, .-poly
+
+# end of generated code
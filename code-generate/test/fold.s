@@ -0,0 +1,492 @@
+# start of generated code
+	.section		.rodata	
+.LC1:
+	.string	"%.2f\n"
+.LC0:
+	.string	"%lld %lld\n"
+	.text	
+	.globl	sum_to
+	.type	sum_to, @function
+sum_to:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -72(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jle	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	cqto	
+	movq	-112(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -120(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-120(%rbp), %rax
+	movq	-128(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS7
+	movq	$0, %rax
+	jmp	 .POS8
+.POS7:
+	movq	$1, %rax
+.POS8:
+	movq	%rax, -136(%rbp)
+	movq	-136(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	jmp	 .POS1
+	jmp	 .POS6
+.POS5:
+.POS6:
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	movq	-144(%rbp), %rax
+	movq	%rax, -80(%rbp)
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	jmp	 .POS0
+.POS2:
+	movq	-80(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	sum_to, .-sum_to
+	.globl	total_to
+	.type	total_to, @function
+total_to:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -72(%rbp)
+.POS9:
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jle	 .POS12
+	movq	$0, %rax
+	jmp	 .POS13
+.POS12:
+	movq	$1, %rax
+.POS13:
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS11
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	cqto	
+	movq	-112(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -120(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-120(%rbp), %rax
+	movq	-128(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS16
+	movq	$0, %rax
+	jmp	 .POS17
+.POS16:
+	movq	$1, %rax
+.POS17:
+	movq	%rax, -136(%rbp)
+	movq	-136(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS14
+	jmp	 .POS10
+	jmp	 .POS15
+.POS14:
+.POS15:
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	movq	-144(%rbp), %rax
+	movq	%rax, -80(%rbp)
+.POS10:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	jmp	 .POS9
+.POS11:
+	movq	-80(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	total_to, .-total_to
+	.globl	count_down
+	.type	count_down, @function
+count_down:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jle	 .POS20
+	movq	$0, %rax
+	jmp	 .POS21
+.POS20:
+	movq	$1, %rax
+.POS21:
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS18
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	jmp	 .POS19
+.POS18:
+.POS19:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	movq	-112(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 count_down
+	subq	$8, %rsp
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	count_down, .-count_down
+	.globl	steps
+	.type	steps, @function
+steps:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jle	 .POS24
+	movq	$0, %rax
+	jmp	 .POS25
+.POS24:
+	movq	$1, %rax
+.POS25:
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS22
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	jmp	 .POS23
+.POS22:
+.POS23:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	movq	-112(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 steps
+	subq	$8, %rsp
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	steps, .-steps
+	.globl	twice
+	.type	twice, @function
+twice:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movsd	-64(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -72(%rbp)
+	movsd	-72(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	twice, .-twice
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -16(%rbp)
+	movq	-16(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 sum_to
+	subq	$8, %rsp
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 total_to
+	subq	$8, %rsp
+	movq	%rax, -40(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-24(%rbp), %rsi
+	movq	-40(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	$25, %rax
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 count_down
+	subq	$8, %rsp
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$30, %rax
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 steps
+	subq	$8, %rsp
+	movq	%rax, -88(%rbp)
+	movq	-56(%rbp), %rdi
+	movq	-72(%rbp), %rsi
+	movq	-88(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ffc000000000000, %rax
+	movq	%rax, -112(%rbp)
+	movsd	-112(%rbp), %xmm0
+	andq	$-16, %rsp
+	call	 twice
+	subq	$8, %rsp
+	movsd	%xmm0, -120(%rbp)
+	movq	-104(%rbp), %rdi
+	movsd	-120(%rbp), %xmm0
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
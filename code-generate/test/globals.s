@@ -0,0 +1,269 @@
+# start of generated code
+	.data	
+	.globl	g
+	.align	8
+	.type	g, @object
+	.size	g, 8
+g:
+	.quad	0
+	.globl	flag
+	.align	8
+	.type	flag, @object
+	.size	flag, 8
+flag:
+	.long	0
+	.section		.rodata	
+.LC1:
+	.string	"%lld %lld\n"
+.LC0:
+	.string	"%lld %lld %lld\n"
+	.text	
+	.globl	touch
+	.type	touch, @function
+touch:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	g(%rip), %rax
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, g(%rip)
+	subq	$8, %rsp
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	flag(%rip), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rax
+	movq	$0x0000000000000001, %rdx
+	xorq	%rdx, %rax
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	movq	%rax, flag(%rip)
+	subq	$8, %rsp
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -120(%rbp)
+	movq	-120(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	touch, .-touch
+	.globl	unused
+	.type	unused, @function
+unused:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	movq	%rax, g(%rip)
+	subq	$8, %rsp
+	movq	%rax, -72(%rbp)
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	unused, .-unused
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, g(%rip)
+	subq	$8, %rsp
+	movq	%rax, -40(%rbp)
+	subq	$8, %rsp
+	movq	g(%rip), %rax
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	-48(%rbp), %rbx
+	movq	-56(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -64(%rbp)
+	movq	-64(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	andq	$-16, %rsp
+	call	 touch
+	subq	$8, %rsp
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	g(%rip), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	g(%rip), %rax
+	movq	%rax, -112(%rbp)
+	movq	-104(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	movq	-24(%rbp), %rdx
+	movq	-112(%rbp), %rcx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-136(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	subq	$8, %rsp
+	movq	flag(%rip), %rax
+	movq	%rax, -152(%rbp)
+	movq	-152(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	subq	$8, %rsp
+	movq	g(%rip), %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-160(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -168(%rbp)
+	movq	-168(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	jmp	 .POS6
+.POS5:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-176(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -184(%rbp)
+	movq	-184(%rbp), %rax
+	movq	%rax, -16(%rbp)
+.POS6:
+	andq	$-16, %rsp
+	call	 touch
+	subq	$8, %rsp
+	movq	%rax, -192(%rbp)
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-200(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -208(%rbp)
+	movq	-208(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS0
+.POS2:
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -216(%rbp)
+	movq	-216(%rbp), %rax
+	movq	%rax, g(%rip)
+	subq	$8, %rsp
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movq	g(%rip), %rax
+	movq	%rax, -240(%rbp)
+	movq	-232(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	movq	-240(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
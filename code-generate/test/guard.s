@@ -0,0 +1,411 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%d\n"
+	.text	
+	.globl	check
+	.type	check, @function
+check:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%xmm0, -80(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -96(%rbp)
+	movq	-96(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-104(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	-112(%rbp), %rdx
+	orq	%rax, %rdx
+	movq	%rdx, -120(%rbp)
+	movq	-120(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	movq	-136(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	jmp	 .POS1
+.POS0:
+.POS1:
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	$0x0000000000000001, %rdx
+	xorq	%rdx, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	cqto	
+	movq	-152(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -160(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	-160(%rbp), %rax
+	movq	-168(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS6
+	movq	$0, %rax
+	jmp	 .POS7
+.POS6:
+	movq	$1, %rax
+.POS7:
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-144(%rbp), %rax
+	movq	-176(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -184(%rbp)
+	movq	-184(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS4
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-192(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -200(%rbp)
+	movq	-200(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	jmp	 .POS5
+.POS4:
+.POS5:
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-208(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jge	 .POS10
+	movq	$0, %rax
+	jmp	 .POS11
+.POS10:
+	movq	$1, %rax
+.POS11:
+	movq	%rax, -216(%rbp)
+	subq	$8, %rsp
+	movq	$15, %rax
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-224(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jle	 .POS12
+	movq	$0, %rax
+	jmp	 .POS13
+.POS12:
+	movq	$1, %rax
+.POS13:
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movq	-216(%rbp), %rax
+	movq	-232(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -240(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -248(%rbp)
+	subq	$8, %rsp
+	movsd	-80(%rbp), %xmm0
+	movsd	-248(%rbp), %xmm1
+	ucomisd	%xmm1, %xmm0
+	jb	 .POS14
+	movq	$0, %rax
+	jmp	 .POS15
+.POS14:
+	movq	$1, %rax
+.POS15:
+	movq	%rax, -256(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -264(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-264(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS16
+	movq	$0, %rax
+	jmp	 .POS17
+.POS16:
+	movq	$1, %rax
+.POS17:
+	movq	%rax, -272(%rbp)
+	subq	$8, %rsp
+	movq	-272(%rbp), %rax
+	movq	$0x0000000000000001, %rdx
+	xorq	%rdx, %rax
+	movq	%rax, -280(%rbp)
+	subq	$8, %rsp
+	movq	-256(%rbp), %rax
+	movq	-280(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -288(%rbp)
+	subq	$8, %rsp
+	movq	-240(%rbp), %rax
+	movq	-288(%rbp), %rdx
+	orq	%rax, %rdx
+	movq	%rdx, -296(%rbp)
+	movq	-296(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS8
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -304(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-304(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -312(%rbp)
+	movq	-312(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	jmp	 .POS9
+.POS8:
+.POS9:
+.POS18:
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -320(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rax
+	movq	-320(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS20
+	movq	$0, %rax
+	jmp	 .POS21
+.POS20:
+	movq	$1, %rax
+.POS21:
+	movq	%rax, -328(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -336(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-336(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jne	 .POS22
+	movq	$0, %rax
+	jmp	 .POS23
+.POS22:
+	movq	$1, %rax
+.POS23:
+	movq	%rax, -344(%rbp)
+	subq	$8, %rsp
+	movq	-344(%rbp), %rax
+	movq	$0x0000000000000001, %rdx
+	xorq	%rdx, %rax
+	movq	%rax, -352(%rbp)
+	subq	$8, %rsp
+	movq	-328(%rbp), %rax
+	movq	-352(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -360(%rbp)
+	movq	-360(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS19
+	subq	$8, %rsp
+	movq	$400, %rax
+	movq	%rax, -368(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-368(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -376(%rbp)
+	movq	-376(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	jmp	 .POS18
+.POS19:
+	movq	-88(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	check, .-check
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS24:
+	subq	$8, %rsp
+	movq	$20, %rax
+	movq	%rax, -40(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-40(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS27
+	movq	$0, %rax
+	jmp	 .POS28
+.POS27:
+	movq	$1, %rax
+.POS28:
+	movq	%rax, -48(%rbp)
+	movq	-48(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS26
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-56(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -64(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-72(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS29
+	movq	$0, %rax
+	jmp	 .POS30
+.POS29:
+	movq	$1, %rax
+.POS30:
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fb999999999999a, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-104(%rbp), %xmm4
+	movq	-8(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-96(%rbp), %rsi
+	movsd	-112(%rbp), %xmm0
+	andq	$-16, %rsp
+	call	 check
+	subq	$8, %rsp
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$1000003, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rax
+	cqto	
+	movq	-136(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -144(%rbp)
+	movq	-144(%rbp), %rax
+	movq	%rax, -16(%rbp)
+.POS25:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS24
+.POS26:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -168(%rbp)
+	movq	-168(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,539 @@
+# start of generated code
+	.section		.rodata	
+.LC2:
+	.string	"%d %d %d\n"
+.LC1:
+	.string	"%d\n"
+.LC0:
+	.string	"zero\n"
+	.text	
+	.globl	classify
+	.type	classify, @function
+classify:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rdi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	jmp	 .POS1
+.POS0:
+.POS1:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-112(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS6
+	movq	$0, %rax
+	jmp	 .POS7
+.POS6:
+	movq	$1, %rax
+.POS7:
+	movq	%rax, -120(%rbp)
+	movq	-120(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS4
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-128(%rbp), %rax
+	negq	%rax
+	movq	%rax, -136(%rbp)
+	movq	-136(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	jmp	 .POS5
+.POS4:
+.POS5:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	classify, .-classify
+	.globl	search
+	.type	search, @function
+search:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	negq	%rax
+	movq	%rax, -112(%rbp)
+	movq	-112(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -120(%rbp)
+	movq	-120(%rbp), %rax
+	movq	%rax, -80(%rbp)
+.POS8:
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS11
+	movq	$0, %rax
+	jmp	 .POS12
+.POS11:
+	movq	$1, %rax
+.POS12:
+	movq	%rax, -128(%rbp)
+	movq	-128(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS10
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -136(%rbp)
+	movq	-136(%rbp), %rax
+	movq	%rax, -88(%rbp)
+.POS13:
+	subq	$8, %rsp
+	movq	-88(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS15
+	movq	$0, %rax
+	jmp	 .POS16
+.POS15:
+	movq	$1, %rax
+.POS16:
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS14
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rax
+	cqto	
+	movq	-168(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -176(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	-176(%rbp), %rax
+	movq	-184(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS19
+	movq	$0, %rax
+	jmp	 .POS20
+.POS19:
+	movq	$1, %rax
+.POS20:
+	movq	%rax, -192(%rbp)
+	movq	-192(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS17
+	jmp	 .POS13
+	jmp	 .POS18
+.POS17:
+.POS18:
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -200(%rbp)
+	subq	$8, %rsp
+	movq	-200(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS23
+	movq	$0, %rax
+	jmp	 .POS24
+.POS23:
+	movq	$1, %rax
+.POS24:
+	movq	%rax, -208(%rbp)
+	movq	-208(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS21
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -216(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-216(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -224(%rbp)
+	subq	$8, %rsp
+	movq	-224(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -232(%rbp)
+	movq	-232(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	jmp	 .POS14
+	jmp	 .POS22
+.POS21:
+.POS22:
+	jmp	 .POS13
+.POS14:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -240(%rbp)
+	subq	$8, %rsp
+	movq	-240(%rbp), %rax
+	negq	%rax
+	movq	%rax, -248(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rax
+	movq	-248(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jne	 .POS27
+	movq	$0, %rax
+	jmp	 .POS28
+.POS27:
+	movq	$1, %rax
+.POS28:
+	movq	%rax, -256(%rbp)
+	movq	-256(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS25
+	jmp	 .POS10
+	jmp	 .POS26
+.POS25:
+.POS26:
+.POS9:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -264(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-264(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -272(%rbp)
+	movq	-272(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	jmp	 .POS8
+.POS10:
+	movq	-96(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	search, .-search
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -32(%rbp)
+	subq	$8, %rsp
+	movq	-32(%rbp), %rax
+	negq	%rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS29:
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-48(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS32
+	movq	$0, %rax
+	jmp	 .POS33
+.POS32:
+	movq	$1, %rax
+.POS33:
+	movq	%rax, -56(%rbp)
+	movq	-56(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS31
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -64(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -72(%rbp)
+	movq	-8(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 classify
+	subq	$8, %rsp
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-80(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -88(%rbp)
+	movq	-88(%rbp), %rax
+	movq	%rax, -16(%rbp)
+.POS30:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-96(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-104(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS29
+.POS31:
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -112(%rbp)
+	movq	-112(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC2, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	$21, %rax
+	movq	%rax, -144(%rbp)
+	movq	-136(%rbp), %rdi
+	movq	-144(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 search
+	subq	$8, %rsp
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -168(%rbp)
+	movq	-160(%rbp), %rdi
+	movq	-168(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 search
+	subq	$8, %rsp
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	$49, %rax
+	movq	%rax, -192(%rbp)
+	movq	-184(%rbp), %rdi
+	movq	-192(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 search
+	subq	$8, %rsp
+	movq	%rax, -200(%rbp)
+	movq	-128(%rbp), %rdi
+	movq	-152(%rbp), %rsi
+	movq	-176(%rbp), %rdx
+	movq	-200(%rbp), %rcx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -216(%rbp)
+	movq	-216(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS34:
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-224(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS36
+	movq	$0, %rax
+	jmp	 .POS37
+.POS36:
+	movq	$1, %rax
+.POS37:
+	movq	%rax, -232(%rbp)
+	movq	-232(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS35
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -240(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-240(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -248(%rbp)
+	movq	-248(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$49, %rax
+	movq	%rax, -256(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-256(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS40
+	movq	$0, %rax
+	jmp	 .POS41
+.POS40:
+	movq	$1, %rax
+.POS41:
+	movq	%rax, -264(%rbp)
+	movq	-264(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS38
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -272(%rbp)
+	movq	-272(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	jmp	 .POS39
+.POS38:
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-8(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -288(%rbp)
+	movq	-288(%rbp), %rax
+	movq	%rax, -16(%rbp)
+.POS39:
+	jmp	 .POS34
+.POS35:
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -296(%rbp)
+	movq	-296(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,494 @@
+# start of generated code
+	.section		.rodata	
+.LC2:
+	.string	"%lld\n"
+.LC1:
+	.string	"count %lld\n"
+.LC0:
+	.string	"%.3f\n"
+	.text	
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	$12, %rdi
+	call	 count
+	movq	%rax, -64(%rbp)
+	movq	$13, %rax
+	pushq	 %rax
+	movq	$11, %rax
+	pushq	 %rax
+	movq	$1, %rdi
+	movq	$2, %rsi
+	movq	$3, %rdx
+	movq	$4, %rcx
+	movq	$5, %r8
+	movq	$6, %r9
+	movq	$7, %r12
+	movq	$8, %r13
+	movq	$9, %r14
+	movq	$10, %r15
+	call	 ints
+	addq	$16, %rsp
+	movq	%rax, -64(%rbp)
+	movq	$.LC2, %rdi
+	movq	-64(%rbp), %rsi
+	movl	$0, %eax
+	call	 printf
+	movq	$0x4022000000000000, %rax
+	pushq	 %rax
+	movq	$0x4021000000000000, %rax
+	pushq	 %rax
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, %xmm0
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, %xmm1
+	movq	$0x3ff8000000000000, %rax
+	movq	%rax, %xmm2
+	movq	$0x4000000000000000, %rax
+	movq	%rax, %xmm3
+	movq	$0x4004000000000000, %rax
+	movq	%rax, %xmm4
+	movq	$0x4008000000000000, %rax
+	movq	%rax, %xmm5
+	movq	$0x400c000000000000, %rax
+	movq	%rax, %xmm6
+	movq	$0x4010000000000000, %rax
+	movq	%rax, %xmm7
+	movq	$0x4012000000000000, %rax
+	movq	%rax, %xmm8
+	movq	$0x4014000000000000, %rax
+	movq	%rax, %xmm9
+	movq	$0x4016000000000000, %rax
+	movq	%rax, %xmm10
+	movq	$0x4018000000000000, %rax
+	movq	%rax, %xmm11
+	movq	$0x401a000000000000, %rax
+	movq	%rax, %xmm12
+	movq	$0x401c000000000000, %rax
+	movq	%rax, %xmm13
+	movq	$0x401e000000000000, %rax
+	movq	%rax, %xmm14
+	movq	$0x4020000000000000, %rax
+	movq	%rax, %xmm15
+	call	 floats
+	addq	$16, %rsp
+	movsd	%xmm0, -64(%rbp)
+	movq	$.LC0, %rdi
+	movl	$1, %eax
+	movsd	-64(%rbp), %xmm0
+	call	 printf
+	movq	$6, %rdi
+	call	 count
+	movq	%rax, -64(%rbp)
+	movq	$1, %rax
+	pushq	 %rax
+	movq	$12, %rax
+	pushq	 %rax
+	movq	$0x3fd0000000000000, %rax
+	movq	$1, %rdi
+	movq	$2, %rsi
+	movq	$3, %rdx
+	movq	%rax, %xmm0
+	movq	$4, %rcx
+	movq	$5, %r8
+	movq	$7, %r9
+	movq	$0x3fe0000000000000, %rax
+	movq	$8, %r12
+	movq	$9, %r13
+	movq	$10, %r14
+	movq	%rax, %xmm1
+	movq	$11, %r15
+	movq	$0x3fe8000000000000, %rax
+	movq	%rax, %xmm2
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, %xmm3
+	call	 mixed
+	addq	$16, %rsp
+	movq	%rax, -64(%rbp)
+	movq	$.LC2, %rdi
+	movq	-64(%rbp), %rsi
+	movl	$0, %eax
+	call	 printf
+	movq	$0, %rax
+	pushq	 %rax
+	movq	$12, %rax
+	pushq	 %rax
+	movq	$0x3fd0000000000000, %rax
+	movq	$1, %rdi
+	movq	$2, %rsi
+	movq	$3, %rdx
+	movq	%rax, %xmm0
+	movq	$4, %rcx
+	movq	$5, %r8
+	movq	$7, %r9
+	movq	$0x3fe0000000000000, %rax
+	movq	$8, %r12
+	movq	$9, %r13
+	movq	$10, %r14
+	movq	%rax, %xmm1
+	movq	$11, %r15
+	movq	$0x3fe8000000000000, %rax
+	movq	%rax, %xmm2
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, %xmm3
+	call	 mixed
+	addq	$16, %rsp
+	movq	%rax, -64(%rbp)
+	movq	$.LC2, %rdi
+	movq	-64(%rbp), %rsi
+	movl	$0, %eax
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+	.type	mixed, @function
+mixed:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	subq	$128, %rsp
+	movq	24(%rbp), %rax
+	movq	%rdi, -8(%rbp)
+	movsd	%xmm0, -16(%rbp)
+	movq	%rsi, -24(%rbp)
+	movsd	%xmm1, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	movsd	%xmm2, -48(%rbp)
+	testq	%rax, %rax
+	movq	%rcx, -56(%rbp)
+	movsd	%xmm3, -64(%rbp)
+	movq	%r8, -72(%rbp)
+	movq	%r9, -88(%rbp)
+	movq	%r12, -96(%rbp)
+	movq	%r13, -104(%rbp)
+	movq	%r14, -112(%rbp)
+	movq	%r15, -120(%rbp)
+	jz	 .POS0
+	movsd	-16(%rbp), %xmm6
+	movsd	-32(%rbp), %xmm7
+	movq	$.LC0, %rdi
+	movl	$1, %eax
+	movsd	-48(%rbp), %xmm9
+	movsd	-64(%rbp), %xmm5
+	addsd	%xmm7, %xmm6
+	movsd	%xmm6, -128(%rbp)
+	movsd	-128(%rbp), %xmm8
+	addsd	%xmm9, %xmm8
+	movsd	%xmm8, -128(%rbp)
+	movsd	-128(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -128(%rbp)
+	movsd	-128(%rbp), %xmm0
+	call	 printf
+.POS0:
+.POS1:
+	movq	-8(%rbp), %r11
+	movq	-24(%rbp), %r10
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-40(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-56(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-72(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-88(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-96(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-104(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-112(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	-120(%rbp), %r10
+	movq	-128(%rbp), %r11
+	addq	%r10, %r11
+	movq	%r11, -128(%rbp)
+	movq	16(%rbp), %r10
+	movq	-128(%rbp), %rbx
+	addq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	leave	
+	ret	
+	.size	mixed, .-mixed
+	.type	count, @function
+count:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movl	$0, %eax
+	movq	-8(%rbp), %rsi
+	movq	$.LC1, %rdi
+	call	 printf
+	movq	-8(%rbp), %rax
+	leave	
+	ret	
+	.size	count, .-count
+	.type	ints, @function
+ints:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	subq	$112, %rsp
+	movq	$2, %r11
+	movq	%rsi, -16(%rbp)
+	movq	%r11, -96(%rbp)
+	movq	-16(%rbp), %r10
+	movq	-96(%rbp), %rbx
+	movq	%rdi, -8(%rbp)
+	movq	$3, %r11
+	movq	%rdx, -24(%rbp)
+	movq	%r11, -104(%rbp)
+	movq	$4, %r11
+	movq	%rcx, -32(%rbp)
+	movq	%r8, -40(%rbp)
+	imulq	%r10, %rbx
+	movq	%r9, -48(%rbp)
+	movq	%r12, -56(%rbp)
+	movq	%r13, -64(%rbp)
+	movq	%rbx, -96(%rbp)
+	movq	-8(%rbp), %rbx
+	movq	-96(%rbp), %r10
+	movq	%r14, -72(%rbp)
+	movq	%r15, -80(%rbp)
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-24(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$5, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-32(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$6, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-40(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$7, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-48(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$8, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-56(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$9, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-64(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$10, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-72(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$11, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-80(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	movq	$12, %r11
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	16(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	movq	%r11, -104(%rbp)
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	24(%rbp), %r10
+	movq	-104(%rbp), %rbx
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	movq	-96(%rbp), %rax
+	leave	
+	ret	
+	.size	ints, .-ints
+	.type	floats, @function
+floats:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	subq	$160, %rsp
+	movsd	%xmm0, -8(%rbp)
+	movq	$0x4024000000000000, %r11
+	movq	$0x4059000000000000, %rax
+	movsd	%xmm1, -16(%rbp)
+	movsd	%xmm4, -40(%rbp)
+	movsd	%xmm5, -48(%rbp)
+	movsd	-8(%rbp), %xmm4
+	movsd	-16(%rbp), %xmm5
+	movsd	%xmm2, -24(%rbp)
+	movsd	%xmm3, -32(%rbp)
+	movsd	%xmm6, -56(%rbp)
+	movsd	%xmm7, -64(%rbp)
+	movsd	%xmm8, -72(%rbp)
+	addsd	%xmm5, %xmm4
+	movsd	%xmm9, -80(%rbp)
+	movsd	-24(%rbp), %xmm5
+	movsd	%xmm10, -88(%rbp)
+	movsd	%xmm11, -96(%rbp)
+	movsd	%xmm12, -104(%rbp)
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	movsd	%xmm13, -112(%rbp)
+	movsd	%xmm14, -120(%rbp)
+	movsd	%xmm15, -128(%rbp)
+	movq	%r11, -152(%rbp)
+	addsd	%xmm5, %xmm4
+	movsd	-32(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-40(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-48(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-56(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-64(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-72(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-80(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-88(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-96(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-104(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-112(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-120(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-128(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	-152(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	16(%rbp), %xmm4
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -152(%rbp)
+	movsd	-144(%rbp), %xmm4
+	movsd	-152(%rbp), %xmm5
+	movq	%rax, -152(%rbp)
+	addsd	%xmm5, %xmm4
+	movsd	-152(%rbp), %xmm5
+	movsd	%xmm4, -144(%rbp)
+	movsd	24(%rbp), %xmm4
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -152(%rbp)
+	movsd	-144(%rbp), %xmm4
+	movsd	-152(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -144(%rbp)
+	movsd	-144(%rbp), %xmm0
+	leave	
+	ret	
+	.size	floats, .-floats
+
+# end of generated code
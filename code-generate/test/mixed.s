@@ -0,0 +1,412 @@
+# start of generated code
+	.data	
+	.globl	g0
+	.align	8
+	.type	g0, @object
+	.size	g0, 8
+g0:
+	.long	0
+	.long	0
+	.globl	n
+	.align	8
+	.type	n, @object
+	.size	n, 8
+n:
+	.quad	0
+	.section		.rodata	
+.LC1:
+	.string	"%.4f %.4f\n"
+.LC0:
+	.string	"%lld %.4f\n"
+	.text	
+	.globl	scale
+	.type	scale, @function
+scale:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -88(%rbp)
+	subq	$8, %rsp
+	movq	g0(%rip), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-96(%rbp), %xmm4
+	movsd	-104(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movsd	-112(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -120(%rbp)
+	movq	-120(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	movsd	-72(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	scale, .-scale
+	.globl	blend
+	.type	blend, @function
+blend:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rdi, -72(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movq	-72(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	divsd	%xmm5, %xmm4
+	movsd	%xmm4, -88(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fd0000000000000, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movsd	-96(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-88(%rbp), %xmm4
+	movsd	-104(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movsd	-64(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -120(%rbp)
+	subq	$8, %rsp
+	movsd	-112(%rbp), %xmm4
+	movsd	-120(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	cvtsi2sdq	%rax, %xmm0
+	movsd	-64(%rbp), %xmm1
+	ucomisd	%xmm1, %xmm0
+	jb	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -136(%rbp)
+	movq	-136(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movsd	-80(%rbp), %xmm4
+	movq	-144(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -152(%rbp)
+	movq	-152(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	jmp	 .POS1
+.POS0:
+.POS1:
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movsd	-160(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -168(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm0
+	movsd	-168(%rbp), %xmm1
+	ucomisd	%xmm1, %xmm0
+	jae	 .POS6
+	movq	$0, %rax
+	jmp	 .POS7
+.POS6:
+	movq	$1, %rax
+.POS7:
+	movq	%rax, -176(%rbp)
+	movq	-176(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS4
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movsd	-80(%rbp), %xmm4
+	movq	-184(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -192(%rbp)
+	movq	-192(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	jmp	 .POS5
+.POS4:
+.POS5:
+	movsd	-80(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	blend, .-blend
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0x4012000000000000, %rax
+	movq	%rax, -24(%rbp)
+	movq	-24(%rbp), %rax
+	movq	%rax, g0(%rip)
+	subq	$8, %rsp
+	movq	%rax, -32(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, n(%rip)
+	subq	$8, %rsp
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	$0x0, %rax
+	movq	%rax, -56(%rbp)
+	movq	-56(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS8:
+	subq	$8, %rsp
+	movq	n(%rip), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS11
+	movq	$0, %rax
+	jmp	 .POS12
+.POS11:
+	movq	$1, %rax
+.POS12:
+	movq	%rax, -80(%rbp)
+	movq	-80(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS10
+	movq	-8(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 scale
+	subq	$8, %rsp
+	movsd	%xmm0, -88(%rbp)
+	subq	$8, %rsp
+	movsd	-16(%rbp), %xmm4
+	movsd	-88(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -96(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	movsd	-16(%rbp), %xmm0
+	movq	-112(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 blend
+	subq	$8, %rsp
+	movsd	%xmm0, -120(%rbp)
+	subq	$8, %rsp
+	movsd	-96(%rbp), %xmm4
+	movsd	-120(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movsd	-16(%rbp), %xmm0
+	movq	-136(%rbp), %rax
+	cvtsi2sdq	%rax, %xmm1
+	ucomisd	%xmm1, %xmm0
+	ja	 .POS15
+	movq	$0, %rax
+	jmp	 .POS16
+.POS15:
+	movq	$1, %rax
+.POS16:
+	movq	%rax, -144(%rbp)
+	movq	-144(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS13
+	subq	$8, %rsp
+	movq	n(%rip), %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movsd	-16(%rbp), %xmm4
+	movq	-152(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	divsd	%xmm5, %xmm4
+	movsd	%xmm4, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	jmp	 .POS14
+.POS13:
+.POS14:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -168(%rbp)
+	movq	-168(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	movsd	-16(%rbp), %xmm0
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+.POS9:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-184(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -192(%rbp)
+	movq	-192(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS8
+.POS10:
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	n(%rip), %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	g0(%rip), %rax
+	movq	%rax, -216(%rbp)
+	subq	$8, %rsp
+	movq	-208(%rbp), %rbx
+	movsd	-216(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -224(%rbp)
+	subq	$8, %rsp
+	movq	$0x8000000000000000, %rax
+	movq	-224(%rbp), %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, -232(%rbp)
+	subq	$8, %rsp
+	movq	n(%rip), %rax
+	movq	%rax, -240(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -248(%rbp)
+	subq	$8, %rsp
+	movq	-240(%rbp), %rbx
+	movsd	-248(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	divsd	%xmm5, %xmm4
+	movsd	%xmm4, -256(%rbp)
+	subq	$8, %rsp
+	movq	n(%rip), %rax
+	movq	%rax, -264(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -272(%rbp)
+	subq	$8, %rsp
+	movq	-264(%rbp), %rax
+	cqto	
+	movq	-272(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -280(%rbp)
+	subq	$8, %rsp
+	movsd	-256(%rbp), %xmm4
+	movq	-280(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -288(%rbp)
+	movq	-200(%rbp), %rdi
+	movsd	-232(%rbp), %xmm0
+	movsd	-288(%rbp), %xmm1
+	subq	$8, %rsp
+	movl	$2, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
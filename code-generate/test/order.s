@@ -0,0 +1,432 @@
+# start of generated code
+	.section		.rodata	
+.LC1:
+	.string	"%lld\n"
+.LC0:
+	.string	"%lld %.6f\n"
+	.text	
+	.globl	mix
+	.type	mix, @function
+mix:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	%rcx, -88(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-96(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-80(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -112(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	orq	%rax, %rdx
+	movq	%rdx, -120(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-120(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	andq	%rax, %rdx
+	movq	%rdx, -160(%rbp)
+	subq	$8, %rsp
+	movq	-144(%rbp), %rbx
+	movq	-160(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -168(%rbp)
+	subq	$8, %rsp
+	movq	-136(%rbp), %rax
+	cqto	
+	movq	-168(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-176(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -184(%rbp)
+	movq	-184(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	mix, .-mix
+	.globl	poly
+	.type	poly, @function
+poly:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%xmm1, -72(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movsd	-64(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -80(%rbp)
+	subq	$8, %rsp
+	movq	$0x4004000000000000, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movsd	-72(%rbp), %xmm4
+	movsd	-88(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -96(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movsd	-96(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-72(%rbp), %xmm4
+	movsd	-104(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	subq	$8, %rsp
+	movsd	-72(%rbp), %xmm4
+	movsd	-72(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -120(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movsd	-120(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -128(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movsd	-128(%rbp), %xmm4
+	movsd	-136(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -144(%rbp)
+	subq	$8, %rsp
+	movsd	-112(%rbp), %xmm4
+	movsd	-144(%rbp), %xmm5
+	divsd	%xmm5, %xmm4
+	movsd	%xmm4, -152(%rbp)
+	subq	$8, %rsp
+	movsd	-80(%rbp), %xmm4
+	movsd	-152(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -160(%rbp)
+	movsd	-160(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	poly, .-poly
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0x0, %rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -48(%rbp)
+	movq	-48(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	$5000, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	subq	$8, %rsp
+	movq	$13, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-72(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-88(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -96(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -120(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-80(%rbp), %rsi
+	movq	-112(%rbp), %rdx
+	movq	-120(%rbp), %rcx
+	andq	$-16, %rsp
+	call	 mix
+	subq	$8, %rsp
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	-128(%rbp), %rax
+	cqto	
+	movq	-136(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -144(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-144(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -152(%rbp)
+	movq	-152(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-160(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -168(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-168(%rbp), %rax
+	movq	-176(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS7
+	movq	$0, %rax
+	jmp	 .POS8
+.POS7:
+	movq	$1, %rax
+.POS8:
+	movq	%rax, -184(%rbp)
+	movq	-184(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-192(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -200(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	-200(%rbp), %rbx
+	movsd	-208(%rbp), %xmm5
+	cvtsi2sdq	%rbx, %xmm4
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -216(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -224(%rbp)
+	movsd	-216(%rbp), %xmm0
+	movsd	-224(%rbp), %xmm1
+	andq	$-16, %rsp
+	call	 poly
+	subq	$8, %rsp
+	movsd	%xmm0, -232(%rbp)
+	subq	$8, %rsp
+	movsd	-24(%rbp), %xmm4
+	movsd	-232(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -240(%rbp)
+	movq	-240(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	jmp	 .POS6
+.POS5:
+.POS6:
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -248(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-248(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -256(%rbp)
+	movq	-256(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS0
+.POS2:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -264(%rbp)
+	movq	-264(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	movsd	-24(%rbp), %xmm0
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -280(%rbp)
+	subq	$8, %rsp
+	movq	$17, %rax
+	movq	%rax, -288(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rax
+	cqto	
+	movq	-288(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -296(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -304(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rax
+	cqto	
+	movq	-304(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -312(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -320(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rax
+	cqto	
+	movq	-320(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -328(%rbp)
+	subq	$8, %rsp
+	movq	$11, %rax
+	movq	%rax, -336(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rax
+	cqto	
+	movq	-336(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -344(%rbp)
+	subq	$8, %rsp
+	movq	-328(%rbp), %rbx
+	movq	-344(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -352(%rbp)
+	subq	$8, %rsp
+	movq	-312(%rbp), %rbx
+	movq	-352(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -360(%rbp)
+	subq	$8, %rsp
+	movq	-296(%rbp), %rbx
+	movq	-360(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -368(%rbp)
+	movq	-280(%rbp), %rdi
+	movq	-368(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
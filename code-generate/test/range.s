@@ -0,0 +1,429 @@
+# start of generated code
+	.section		.rodata	
+.LC1:
+	.string	"%lld %lld\n"
+.LC0:
+	.string	"%lld\n"
+	.text	
+	.globl	digits
+	.type	digits, @function
+digits:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-96(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-112(%rbp), %rbx
+	movq	-64(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -120(%rbp)
+	movq	-120(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	jmp	 .POS1
+.POS0:
+.POS1:
+.POS4:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-128(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS6
+	movq	$0, %rax
+	jmp	 .POS7
+.POS6:
+	movq	$1, %rax
+.POS7:
+	movq	%rax, -136(%rbp)
+	movq	-136(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	cqto	
+	movq	-144(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -152(%rbp)
+	movq	-152(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rbx
+	movq	-80(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	cqto	
+	movq	-168(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -176(%rbp)
+	movq	-176(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	jmp	 .POS4
+.POS5:
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	digits, .-digits
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -48(%rbp)
+	movq	-48(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS8:
+	subq	$8, %rsp
+	movq	$1000, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS11
+	movq	$0, %rax
+	jmp	 .POS12
+.POS11:
+	movq	$1, %rax
+.POS12:
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS10
+	subq	$8, %rsp
+	movq	$31, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -80(%rbp)
+	subq	$8, %rsp
+	movq	$97, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-88(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -96(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-96(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	subq	$8, %rsp
+	movq	$1000003, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rax
+	cqto	
+	movq	-112(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -120(%rbp)
+	movq	-120(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$8, %rax
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-128(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -136(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	-136(%rbp), %rax
+	movq	-144(%rbp), %rdx
+	cmpq	%rdx, %rax
+	je	 .POS15
+	movq	$0, %rax
+	jmp	 .POS16
+.POS15:
+	movq	$1, %rax
+.POS16:
+	movq	%rax, -152(%rbp)
+	movq	-152(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS13
+	subq	$8, %rsp
+	movq	$4, %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-160(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-168(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -176(%rbp)
+	movq	-176(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	jmp	 .POS14
+.POS13:
+.POS14:
+.POS9:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -184(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-184(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -192(%rbp)
+	movq	-192(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS8
+.POS10:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -200(%rbp)
+	movq	-200(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -216(%rbp)
+	movq	-216(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	$50, %rax
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movq	-224(%rbp), %rbx
+	movq	-232(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -240(%rbp)
+	movq	-240(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS17:
+	subq	$8, %rsp
+	movq	$50, %rax
+	movq	%rax, -248(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-248(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS20
+	movq	$0, %rax
+	jmp	 .POS21
+.POS20:
+	movq	$1, %rax
+.POS21:
+	movq	%rax, -256(%rbp)
+	movq	-256(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS19
+	subq	$8, %rsp
+	movq	$6, %rax
+	movq	%rax, -264(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-264(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -272(%rbp)
+	subq	$8, %rsp
+	movq	-24(%rbp), %rbx
+	movq	-272(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -280(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -288(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	cqto	
+	movq	-288(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -296(%rbp)
+	subq	$8, %rsp
+	movq	-280(%rbp), %rbx
+	movq	-296(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -304(%rbp)
+	movq	-304(%rbp), %rax
+	movq	%rax, -24(%rbp)
+.POS18:
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -312(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-312(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -320(%rbp)
+	movq	-320(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS17
+.POS19:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -328(%rbp)
+	movq	-328(%rbp), %rdi
+	movq	-24(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$5000000000, %rax
+	movq	%rax, -344(%rbp)
+	movq	-344(%rbp), %rax
+	movq	%rax, -32(%rbp)
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -352(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -360(%rbp)
+	subq	$8, %rsp
+	movq	-32(%rbp), %rax
+	cqto	
+	movq	-360(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -368(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -376(%rbp)
+	subq	$8, %rsp
+	movq	-32(%rbp), %rax
+	cqto	
+	movq	-376(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -384(%rbp)
+	movq	-352(%rbp), %rdi
+	movq	-368(%rbp), %rsi
+	movq	-384(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -400(%rbp)
+	subq	$8, %rsp
+	movq	$1234567, %rax
+	movq	%rax, -408(%rbp)
+	movq	-408(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 digits
+	subq	$8, %rsp
+	movq	%rax, -416(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -424(%rbp)
+	subq	$8, %rsp
+	movq	$98765, %rax
+	movq	%rax, -432(%rbp)
+	subq	$8, %rsp
+	movq	-424(%rbp), %rbx
+	movq	-432(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -440(%rbp)
+	movq	-440(%rbp), %rdi
+	andq	$-16, %rsp
+	call	 digits
+	subq	$8, %rsp
+	movq	%rax, -448(%rbp)
+	movq	-400(%rbp), %rdi
+	movq	-416(%rbp), %rsi
+	movq	-448(%rbp), %rdx
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
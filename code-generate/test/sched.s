@@ -0,0 +1,383 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%f %d\n"
+	.text	
+	.globl	dot
+	.type	dot, @function
+dot:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%xmm1, -72(%rbp)
+	subq	$8, %rsp
+	movq	%xmm2, -80(%rbp)
+	subq	$8, %rsp
+	movq	%xmm3, -88(%rbp)
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm4
+	movsd	-80(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -96(%rbp)
+	subq	$8, %rsp
+	movsd	-72(%rbp), %xmm4
+	movsd	-88(%rbp), %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-96(%rbp), %xmm4
+	movsd	-104(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	movsd	-112(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	dot, .-dot
+	.globl	slope
+	.type	slope, @function
+slope:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%xmm1, -72(%rbp)
+	subq	$8, %rsp
+	movq	%xmm2, -80(%rbp)
+	subq	$8, %rsp
+	movq	%xmm3, -88(%rbp)
+	subq	$8, %rsp
+	movsd	-88(%rbp), %xmm4
+	movsd	-72(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -96(%rbp)
+	subq	$8, %rsp
+	movsd	-80(%rbp), %xmm4
+	movsd	-64(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-96(%rbp), %xmm4
+	movsd	-104(%rbp), %xmm5
+	divsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	movsd	-112(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	slope, .-slope
+	.globl	mix
+	.type	mix, @function
+mix:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-104(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -112(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-112(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -120(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-72(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-136(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	subq	$8, %rsp
+	movq	-128(%rbp), %rbx
+	movq	-144(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -152(%rbp)
+	subq	$8, %rsp
+	movq	-120(%rbp), %rbx
+	movq	-152(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -168(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	cqto	
+	movq	-168(%rbp), %rbx
+	idivq	%rbx
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-176(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -184(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	-72(%rbp), %rax
+	cqto	
+	movq	-192(%rbp), %rbx
+	idivq	%rbx
+	movq	%rdx, -200(%rbp)
+	subq	$8, %rsp
+	movq	-184(%rbp), %rbx
+	movq	-200(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -208(%rbp)
+	movq	-208(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	mix, .-mix
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0x0, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -48(%rbp)
+	movq	-48(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	$20, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	subq	$8, %rsp
+	movq	$0x3ff8000000000000, %rax
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movsd	-72(%rbp), %xmm4
+	movq	-8(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -80(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fd0000000000000, %rax
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movsd	-104(%rbp), %xmm4
+	movq	-8(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	mulsd	%xmm5, %xmm4
+	movsd	%xmm4, -112(%rbp)
+	movsd	-80(%rbp), %xmm0
+	movsd	-88(%rbp), %xmm1
+	movsd	-96(%rbp), %xmm2
+	movsd	-112(%rbp), %xmm3
+	andq	$-16, %rsp
+	call	 dot
+	subq	$8, %rsp
+	movsd	%xmm0, -120(%rbp)
+	subq	$8, %rsp
+	movsd	-16(%rbp), %xmm4
+	movsd	-120(%rbp), %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -128(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	$0x4000000000000000, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff0000000000000, %rax
+	movq	%rax, -152(%rbp)
+	subq	$8, %rsp
+	movsd	-152(%rbp), %xmm4
+	movq	-8(%rbp), %rbx
+	cvtsi2sdq	%rbx, %xmm5
+	addsd	%xmm5, %xmm4
+	movsd	%xmm4, -160(%rbp)
+	subq	$8, %rsp
+	movq	$0x400c000000000000, %rax
+	movq	%rax, -168(%rbp)
+	movsd	-136(%rbp), %xmm0
+	movsd	-144(%rbp), %xmm1
+	movsd	-160(%rbp), %xmm2
+	movsd	-168(%rbp), %xmm3
+	andq	$-16, %rsp
+	call	 slope
+	subq	$8, %rsp
+	movsd	%xmm0, -176(%rbp)
+	subq	$8, %rsp
+	movsd	-128(%rbp), %xmm4
+	movsd	-176(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -184(%rbp)
+	movq	-184(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-192(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -200(%rbp)
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-208(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -216(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-200(%rbp), %rsi
+	movq	-216(%rbp), %rdx
+	andq	$-16, %rsp
+	call	 mix
+	subq	$8, %rsp
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	-24(%rbp), %rbx
+	movq	-224(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -232(%rbp)
+	movq	-232(%rbp), %rax
+	movq	%rax, -24(%rbp)
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -240(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-240(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -248(%rbp)
+	movq	-248(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS0
+.POS2:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -256(%rbp)
+	movq	-256(%rbp), %rdi
+	movsd	-16(%rbp), %xmm0
+	movq	-24(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$1, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
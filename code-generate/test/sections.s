@@ -0,0 +1,276 @@
+# start of generated code
+	.section		.rodata	
+.LC1:
+	.string	"%lld %lld\n"
+.LC0:
+	.string	"rare %lld\n"
+	.text	
+	.section	.text.main,"ax",@progbits
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$24, %rsp
+	movq	$0, -72(%rbp)
+	movq	$0, -64(%rbp)
+	jmp	 .POS0
+.POS3:
+	movq	-64(%rbp), %rdi
+	call	 step
+	movq	%rax, -80(%rbp)
+	movq	-72(%rbp), %rbx
+	movq	-80(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, -72(%rbp)
+.POS1:
+	movq	-64(%rbp), %rbx
+	addq	$1, %rbx
+	movq	%rbx, -80(%rbp)
+	movq	-80(%rbp), %rax
+	movq	%rax, -64(%rbp)
+.POS0:
+	movq	-64(%rbp), %rax
+	cmpq	$200, %rax
+	jl	 .POS3
+.POS2:
+	movq	$20, %rdi
+	call	 walk
+	movq	%rax, -80(%rbp)
+	movq	-72(%rbp), %rsi
+	movq	$.LC1, %rdi
+	movq	-80(%rbp), %rdx
+	movl	$0, %eax
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+	.section	.text.hot.step,"ax",@progbits
+	.globl	step
+	.type	step, @function
+step:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$24, %rsp
+	movq	%rdi, -64(%rbp)
+	movq	$64, %r9
+	movq	%r9, -72(%rbp)
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rbx
+	cqto	
+	idivq	%rbx
+	movq	%rdx, -72(%rbp)
+	movq	-72(%rbp), %rax
+	cmpq	$63, %rax
+	je	 .POS4
+.POS5:
+	movq	-64(%rbp), %rdi
+	call	 leaf
+	movq	%rax, -72(%rbp)
+	movq	$97, %r9
+	movq	%r9, -80(%rbp)
+	movq	-72(%rbp), %rax
+	movq	-80(%rbp), %rbx
+	cqto	
+	idivq	%rbx
+	movq	%rdx, -72(%rbp)
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	step, .-step
+	.section	.text.unlikely.step,"ax",@progbits
+.POS4:
+	movq	-64(%rbp), %rdi
+	call	 rare
+	movq	%rax, -72(%rbp)
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.section	.text.hot.leaf,"ax",@progbits
+	.globl	leaf
+	.type	leaf, @function
+leaf:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$24, %rsp
+	movq	%rdi, -64(%rbp)
+	movq	-64(%rbp), %r9
+	imulq	$3, %r9
+	movq	%r9, -72(%rbp)
+	movq	-72(%rbp), %rbx
+	addq	$1, %rbx
+	movq	%rbx, -72(%rbp)
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	leaf, .-leaf
+	.section	.text.hot.rare,"ax",@progbits
+	.globl	rare
+	.type	rare, @function
+rare:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	movl	$0, %eax
+	movq	-64(%rbp), %rsi
+	movq	$.LC0, %rdi
+	call	 printf
+	movq	-64(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	rare, .-rare
+	.section	.text.hot.walk,"ax",@progbits
+	.globl	walk
+	.type	walk, @function
+walk:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$24, %rsp
+	movq	%rdi, -64(%rbp)
+	movq	-64(%rbp), %rax
+	cmpq	$1, %rax
+	jl	 .POS6
+	jmp	 .POS7
+.POS6:
+	movq	$0, %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+.POS7:
+	movq	-64(%rbp), %rdi
+	call	 step
+	movq	-64(%rbp), %rbx
+	movq	%rax, -72(%rbp)
+	subq	$1, %rbx
+	movq	%rbx, -80(%rbp)
+	movq	-80(%rbp), %rdi
+	call	 walk
+	movq	%rax, -80(%rbp)
+	movq	-72(%rbp), %rbx
+	movq	-80(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -72(%rbp)
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	walk, .-walk
+	.section	.text.unlikely.unused,"ax",@progbits
+	.globl	unused
+	.type	unused, @function
+unused:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$24, %rsp
+	movq	%rdi, -64(%rbp)
+	movq	-64(%rbp), %rdi
+	call	 leaf
+	movq	%rax, -72(%rbp)
+	movq	-72(%rbp), %rbx
+	imulq	$1000, %rbx
+	movq	%rbx, -72(%rbp)
+	movq	-72(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	unused, .-unused
+
+# end of generated code
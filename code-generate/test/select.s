@@ -0,0 +1,373 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%d %f %f\n"
+	.text	
+	.globl	max
+	.type	max, @function
+max:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	movq	-64(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	jmp	 .POS1
+.POS0:
+	movq	-72(%rbp), %rax
+	movq	%rax, -80(%rbp)
+.POS1:
+	movq	-80(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	max, .-max
+	.globl	clamp
+	.type	clamp, @function
+clamp:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-80(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS6
+	movq	$0, %rax
+	jmp	 .POS7
+.POS6:
+	movq	$1, %rax
+.POS7:
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS4
+	movq	-80(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	jmp	 .POS5
+.POS4:
+.POS5:
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS10
+	movq	$0, %rax
+	jmp	 .POS11
+.POS10:
+	movq	$1, %rax
+.POS11:
+	movq	%rax, -96(%rbp)
+	movq	-96(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS8
+	movq	-72(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	jmp	 .POS9
+.POS8:
+.POS9:
+	movq	-64(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	clamp, .-clamp
+	.globl	fmin
+	.type	fmin, @function
+fmin:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%xmm0, -64(%rbp)
+	subq	$8, %rsp
+	movq	%xmm1, -72(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movsd	-64(%rbp), %xmm0
+	movsd	-72(%rbp), %xmm1
+	ucomisd	%xmm1, %xmm0
+	jb	 .POS14
+	movq	$0, %rax
+	jmp	 .POS15
+.POS14:
+	movq	$1, %rax
+.POS15:
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS12
+	movq	-64(%rbp), %rax
+	movq	%rax, -80(%rbp)
+	jmp	 .POS13
+.POS12:
+	movq	-72(%rbp), %rax
+	movq	%rax, -80(%rbp)
+.POS13:
+	movsd	-80(%rbp), %xmm0
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	fmin, .-fmin
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -40(%rbp)
+	subq	$8, %rsp
+	movq	-40(%rbp), %rax
+	negq	%rax
+	movq	%rax, -48(%rbp)
+	movq	-48(%rbp), %rax
+	movq	%rax, -8(%rbp)
+.POS16:
+	subq	$8, %rsp
+	movq	$15, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS19
+	movq	$0, %rax
+	jmp	 .POS20
+.POS19:
+	movq	$1, %rax
+.POS20:
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS18
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -72(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-72(%rbp), %rsi
+	andq	$-16, %rsp
+	call	 max
+	subq	$8, %rsp
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -96(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-96(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -104(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	$9, %rax
+	movq	%rax, -120(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-112(%rbp), %rsi
+	movq	-120(%rbp), %rdx
+	andq	$-16, %rsp
+	call	 clamp
+	subq	$8, %rsp
+	movq	%rax, -128(%rbp)
+	subq	$8, %rsp
+	movq	-104(%rbp), %rbx
+	movq	-128(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -136(%rbp)
+	movq	-136(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -144(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-144(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jge	 .POS23
+	movq	$0, %rax
+	jmp	 .POS24
+.POS23:
+	movq	$1, %rax
+.POS24:
+	movq	%rax, -152(%rbp)
+	movq	-152(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS21
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -160(%rbp)
+	movq	-160(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	jmp	 .POS22
+.POS21:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -168(%rbp)
+	movq	-168(%rbp), %rax
+	movq	%rax, -24(%rbp)
+.POS22:
+	movq	-24(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS25
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-16(%rbp), %rbx
+	movq	-176(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -184(%rbp)
+	movq	-184(%rbp), %rax
+	movq	%rax, -16(%rbp)
+	jmp	 .POS26
+.POS25:
+.POS26:
+.POS17:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rbx
+	movq	-192(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -200(%rbp)
+	movq	-200(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	jmp	 .POS16
+.POS18:
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	$0x3ff8000000000000, %rax
+	movq	%rax, -216(%rbp)
+	subq	$8, %rsp
+	movq	$0x3fe0000000000000, %rax
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	$0x4006000000000000, %rax
+	movq	%rax, -232(%rbp)
+	subq	$8, %rsp
+	movsd	-224(%rbp), %xmm4
+	movsd	-232(%rbp), %xmm5
+	subsd	%xmm5, %xmm4
+	movsd	%xmm4, -240(%rbp)
+	movsd	-216(%rbp), %xmm0
+	movsd	-240(%rbp), %xmm1
+	andq	$-16, %rsp
+	call	 fmin
+	subq	$8, %rsp
+	movsd	%xmm0, -248(%rbp)
+	subq	$8, %rsp
+	movq	$0x4008000000000000, %rax
+	movq	%rax, -256(%rbp)
+	subq	$8, %rsp
+	movq	$0x4010000000000000, %rax
+	movq	%rax, -264(%rbp)
+	movsd	-256(%rbp), %xmm0
+	movsd	-264(%rbp), %xmm1
+	andq	$-16, %rsp
+	call	 fmin
+	subq	$8, %rsp
+	movsd	%xmm0, -272(%rbp)
+	movq	-208(%rbp), %rdi
+	movq	-16(%rbp), %rsi
+	movsd	-248(%rbp), %xmm0
+	movsd	-272(%rbp), %xmm1
+	subq	$8, %rsp
+	movl	$2, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -0,0 +1,92 @@
+# start of generated code
+	.section		.rodata	
+.LC2:
+	.string	"outer %lld\n"
+.LC1:
+	.string	"inner %lld\n"
+.LC0:
+	.string	"small %lld\n"
+	.text	
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$100, %rax
+	movq	%rax, -16(%rbp)
+	movq	-16(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	-8(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS2
+	movq	$0, %rax
+	jmp	 .POS3
+.POS2:
+	movq	$1, %rax
+.POS3:
+	movq	%rax, -32(%rbp)
+	movq	-32(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS0
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -40(%rbp)
+	movq	-40(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	jmp	 .POS1
+.POS0:
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -64(%rbp)
+	movq	-64(%rbp), %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	$.LC1, %rax
+	movq	%rax, -72(%rbp)
+	movq	-72(%rbp), %rdi
+	movq	-56(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+.POS1:
+	subq	$8, %rsp
+	movq	$.LC2, %rax
+	movq	%rax, -88(%rbp)
+	movq	-88(%rbp), %rdi
+	movq	-8(%rbp), %rsi
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
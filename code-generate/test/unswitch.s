@@ -0,0 +1,278 @@
+# start of generated code
+	.section		.rodata	
+.LC0:
+	.string	"%lld %lld %lld %lld\n"
+	.text	
+	.globl	sum
+	.type	sum, @function
+sum:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	%rdi, -64(%rbp)
+	subq	$8, %rsp
+	movq	%rsi, -72(%rbp)
+	subq	$8, %rsp
+	movq	%rdx, -80(%rbp)
+	subq	$8, %rsp
+	subq	$8, %rsp
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -104(%rbp)
+	movq	-104(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -112(%rbp)
+	movq	-112(%rbp), %rax
+	movq	%rax, -88(%rbp)
+.POS0:
+	subq	$8, %rsp
+	movq	-88(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jl	 .POS3
+	movq	$0, %rax
+	jmp	 .POS4
+.POS3:
+	movq	$1, %rax
+.POS4:
+	movq	%rax, -120(%rbp)
+	movq	-120(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS2
+	movq	-72(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS5
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -128(%rbp)
+	movq	-128(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	jmp	 .POS6
+.POS5:
+	subq	$8, %rsp
+	movq	$2, %rax
+	movq	%rax, -136(%rbp)
+	subq	$8, %rsp
+	movq	-136(%rbp), %rbx
+	movq	-88(%rbp), %r10
+	imulq	%r10, %rbx
+	movq	%rbx, -144(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-144(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -152(%rbp)
+	movq	-152(%rbp), %rax
+	movq	%rax, -96(%rbp)
+.POS6:
+	subq	$8, %rsp
+	movq	$3, %rax
+	movq	%rax, -160(%rbp)
+	subq	$8, %rsp
+	movq	-80(%rbp), %rax
+	movq	-160(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS9
+	movq	$0, %rax
+	jmp	 .POS10
+.POS9:
+	movq	$1, %rax
+.POS10:
+	movq	%rax, -168(%rbp)
+	movq	-168(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS7
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -176(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-176(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -184(%rbp)
+	movq	-184(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	jmp	 .POS8
+.POS7:
+.POS8:
+.POS1:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -192(%rbp)
+	subq	$8, %rsp
+	movq	-88(%rbp), %rbx
+	movq	-192(%rbp), %r10
+	addq	%r10, %rbx
+	movq	%rbx, -200(%rbp)
+	movq	-200(%rbp), %rax
+	movq	%rax, -88(%rbp)
+	jmp	 .POS0
+.POS2:
+.POS11:
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -208(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rax
+	movq	-208(%rbp), %rdx
+	cmpq	%rdx, %rax
+	jg	 .POS13
+	movq	$0, %rax
+	jmp	 .POS14
+.POS13:
+	movq	$1, %rax
+.POS14:
+	movq	%rax, -216(%rbp)
+	movq	-216(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS12
+	movq	-72(%rbp), %rax
+	testq	%rax, %rax
+	jz	 .POS15
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -224(%rbp)
+	subq	$8, %rsp
+	movq	-96(%rbp), %rbx
+	movq	-224(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -232(%rbp)
+	movq	-232(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	jmp	 .POS16
+.POS15:
+.POS16:
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -240(%rbp)
+	subq	$8, %rsp
+	movq	-64(%rbp), %rbx
+	movq	-240(%rbp), %r10
+	subq	%r10, %rbx
+	movq	%rbx, -248(%rbp)
+	movq	-248(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	jmp	 .POS11
+.POS12:
+	movq	-96(%rbp), %rax
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	sum, .-sum
+	.globl	main
+	.type	main, @function
+main:
+	pushq	 %rbp
+	movq	%rsp, %rbp
+	pushq	 %rbx
+	pushq	 %r10
+	pushq	 %r11
+	pushq	 %r12
+	pushq	 %r13
+	pushq	 %r14
+	pushq	 %r15
+	subq	$8, %rsp
+	movq	$.LC0, %rax
+	movq	%rax, -8(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -16(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -24(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -32(%rbp)
+	movq	-16(%rbp), %rdi
+	movq	-24(%rbp), %rsi
+	movq	-32(%rbp), %rdx
+	andq	$-16, %rsp
+	call	 sum
+	subq	$8, %rsp
+	movq	%rax, -40(%rbp)
+	subq	$8, %rsp
+	movq	$10, %rax
+	movq	%rax, -48(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -56(%rbp)
+	subq	$8, %rsp
+	movq	$5, %rax
+	movq	%rax, -64(%rbp)
+	movq	-48(%rbp), %rdi
+	movq	-56(%rbp), %rsi
+	movq	-64(%rbp), %rdx
+	andq	$-16, %rsp
+	call	 sum
+	subq	$8, %rsp
+	movq	%rax, -72(%rbp)
+	subq	$8, %rsp
+	movq	$7, %rax
+	movq	%rax, -80(%rbp)
+	subq	$8, %rsp
+	movq	$1, %rax
+	movq	%rax, -88(%rbp)
+	subq	$8, %rsp
+	movq	$9, %rax
+	movq	%rax, -96(%rbp)
+	movq	-80(%rbp), %rdi
+	movq	-88(%rbp), %rsi
+	movq	-96(%rbp), %rdx
+	andq	$-16, %rsp
+	call	 sum
+	subq	$8, %rsp
+	movq	%rax, -104(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -112(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -120(%rbp)
+	subq	$8, %rsp
+	movq	$0, %rax
+	movq	%rax, -128(%rbp)
+	movq	-112(%rbp), %rdi
+	movq	-120(%rbp), %rsi
+	movq	-128(%rbp), %rdx
+	andq	$-16, %rsp
+	call	 sum
+	subq	$8, %rsp
+	movq	%rax, -136(%rbp)
+	movq	-8(%rbp), %rdi
+	movq	-40(%rbp), %rsi
+	movq	-72(%rbp), %rdx
+	movq	-104(%rbp), %rcx
+	movq	-136(%rbp), %r8
+	subq	$8, %rsp
+	movl	$0, %eax
+	andq	$-16, %rsp
+	call	 printf
+	popq	 %r15
+	popq	 %r14
+	popq	 %r13
+	popq	 %r12
+	popq	 %r11
+	popq	 %r10
+	popq	 %rbx
+	leave	
+	ret	
+	.size	main, .-main
+
+# end of generated code
@@ -12,16 +12,25 @@ typedef class Actual_class *Actual;
 typedef class Object_class *Object;
 typedef class Call_class *Call;
 
+// the built-in types as dense tags, kept with the type of an Expr;
+// any other type is NO_TYPE
+enum TypeTag { NO_TYPE, VOID_TYPE, INT_TYPE, FLOAT_TYPE, BOOL_TYPE, STRING_TYPE, TYPE_TAGS };
+TypeTag type_tag(Symbol type);
+Symbol tag_type(TypeTag tag);     // NULL for NO_TYPE
+
 
 class Expr_class : public Stmt_class {
 public:     
    Symbol type;                      
+   TypeTag tag;                      // type_tag(type)
    Symbol getType() { return type; }           
-   Expr setType(Symbol s) { type = s; return this; } 
+   Expr setType(Symbol s) { type = s; tag = type_tag(s); return this; } 
    Stmt copy_Stmt() { return copy_Expr(); }             
-   Expr_class() { type = (Symbol) NULL; }
+   TypeTag getTag() { return tag; }
+   Expr_class() { type = (Symbol) NULL; tag = NO_TYPE; }
    Expr_class(Symbol a1) {
         type = a1;
+        tag = type_tag(a1);
    }
    void check(Symbol a) {checkType();}
    void dump_type(ostream&, int);
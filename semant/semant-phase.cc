@@ -21,6 +21,7 @@ int main(int argc, char *argv[]) {
 	}
   curr_lineno = 1;
   handle_flags(argc,argv);
+  tree_arena.at_release(free_string_tables);
   seal_yyparse();
   if(omerrs != 0 || ast_root == NULL){
     cout << "syntax analyze failed. Please make sure syntax parser passed." << endl;
@@ -29,5 +30,7 @@ int main(int argc, char *argv[]) {
   ast_root->semant();
   ast_root->dump_with_types(cout,0);
   fclose(fin);
+  // the AST and everything semant kept go at once
+  tree_arena.release();
 }
 
@@ -85,6 +85,83 @@ bool isValidTypeName(Symbol type) {
     return type != Void;
 }
 
+// the type of each TypeTag, filled in by initialize_constants
+static Symbol tag_types[TYPE_TAGS];
+
+TypeTag type_tag(Symbol type) {
+    for (int t = VOID_TYPE; t < TYPE_TAGS; t++) {
+        if (tag_types[t] != NULL && tag_types[t] == type) {
+            return (TypeTag) t;
+        }
+    }
+    return NO_TYPE;
+}
+
+Symbol tag_type(TypeTag tag) {
+    return tag_types[tag];
+}
+
+//
+// The types of operators. For each kind of operator and each pair of
+// operand tags, operator_types holds the tag of the result, or MISMATCH
+// when the operands do not fit the operator; unary operators look up
+// their operand as both. Filled in by install_operator_types.
+//
+enum OperatorKind {
+    ARITHMETIC_OPERATOR,    // + - * /
+    MODULO_OPERATOR,        // %
+    ORDER_OPERATOR,         // < <= >= >
+    EQUALITY_OPERATOR,      // == !=
+    LOGICAL_OPERATOR,       // && ||
+    XOR_OPERATOR,           // ^
+    BITWISE_OPERATOR,       // & |
+    NEGATION_OPERATOR,      // unary -
+    NOT_OPERATOR,           // !
+    BITNOT_OPERATOR,        // ~
+    OPERATOR_KINDS
+};
+
+#define MISMATCH -1
+static int operator_types[OPERATOR_KINDS][TYPE_TAGS][TYPE_TAGS];
+
+static bool numeric(int tag) {
+    return tag == INT_TYPE || tag == FLOAT_TYPE;
+}
+
+static void install_operator_types() {
+    for (int l = 0; l < TYPE_TAGS; l++) {
+        for (int r = 0; r < TYPE_TAGS; r++) {
+            bool mixed = numeric(l) && numeric(r) && l != r;
+            operator_types[ARITHMETIC_OPERATOR][l][r] = mixed ? FLOAT_TYPE : l == r ? l : MISMATCH;
+            // codegen has only the integer remainder
+            operator_types[MODULO_OPERATOR][l][r] = l == INT_TYPE && r == INT_TYPE ? INT_TYPE : MISMATCH;
+            operator_types[ORDER_OPERATOR][l][r] = numeric(l) && numeric(r) ? BOOL_TYPE : MISMATCH;
+            operator_types[EQUALITY_OPERATOR][l][r] =
+                (numeric(l) && numeric(r)) || (l == BOOL_TYPE && r == BOOL_TYPE) ? BOOL_TYPE : MISMATCH;
+            operator_types[LOGICAL_OPERATOR][l][r] = l == BOOL_TYPE && r == BOOL_TYPE ? BOOL_TYPE : MISMATCH;
+            operator_types[XOR_OPERATOR][l][r] = l == r && (l == BOOL_TYPE || l == INT_TYPE) ? BOOL_TYPE : MISMATCH;
+            operator_types[BITWISE_OPERATOR][l][r] = l == INT_TYPE && r == INT_TYPE ? INT_TYPE : MISMATCH;
+            operator_types[NEGATION_OPERATOR][l][r] = MISMATCH;
+            operator_types[NOT_OPERATOR][l][r] = MISMATCH;
+            operator_types[BITNOT_OPERATOR][l][r] = MISMATCH;
+        }
+        operator_types[NEGATION_OPERATOR][l][l] = numeric(l) ? l : MISMATCH;
+        operator_types[NOT_OPERATOR][l][l] = l == BOOL_TYPE ? BOOL_TYPE : MISMATCH;
+        operator_types[BITNOT_OPERATOR][l][l] = l == INT_TYPE ? INT_TYPE : MISMATCH;
+    }
+}
+
+// the type of op applied to the checked e1 and e2 into t; false when
+// they do not fit op. A result of e1's tag is e1's own type.
+static bool operator_type(OperatorKind op, Expr e1, Expr e2, Symbol &t) {
+    int tag = operator_types[op][e1->getTag()][e2->getTag()];
+    if (tag == MISMATCH) {
+        return false;
+    }
+    t = tag == e1->getTag() ? e1->getType() : tag_types[tag];
+    return true;
+}
+
 //
 // Initializing the predefined symbols.
 //
@@ -101,6 +178,13 @@ static void initialize_constants(void) {
 
     // classical function to print things, so defined here for call.
     print        = idtable.add_string("printf");
+
+    tag_types[VOID_TYPE]   = Void;
+    tag_types[INT_TYPE]    = Int;
+    tag_types[FLOAT_TYPE]  = Float;
+    tag_types[BOOL_TYPE]   = Bool;
+    tag_types[STRING_TYPE] = String;
+    install_operator_types();
 }
 
 /*
@@ -110,10 +194,6 @@ static void initialize_constants(void) {
     Of course, you can add any other functions to help.
 */
 
-static bool sameType(Symbol name1, Symbol name2) {
-    return strcmp(name1->get_string(), name2->get_string()) == 0;
-}
-
 static void install_calls(Decls decls) {
     for (int i=decls->first(); decls->more(i); i=decls->next(i)) {
         Symbol name = decls->nth(i)->getName();
@@ -173,7 +253,7 @@ void VariableDecl_class::check() {
     if (type == Void) {
         semant_error()<<"var "<<name<<" cannot be of type Void. Void can just be used as return type."<<endl;
     } else {
-        objectEnv.addid(name, new Symbol(type));
+        objectEnv.addid(name, tree_arena.create<Symbol>(type));
         localVars[name] = type;
     }
 }
@@ -224,7 +304,7 @@ void CallDecl_class::check() {
             if (objectEnv.lookup(name) != NULL) {
                 semant_error(this)<<"Function "<<funcName<< "'s parameter has a duplicate name "<<name<<endl;
             }
-            objectEnv.addid(name, new Symbol (type));
+            objectEnv.addid(name, tree_arena.create<Symbol>(type));
             localVars[name] = type;
         }
         // main function should not have any paras
@@ -234,14 +314,7 @@ void CallDecl_class::check() {
             semant_error(this)<<"main function should have return type Void."<<endl;
         }
 
-        // check stmtBlock
-        // 1. check variableDecls
-        VariableDecls varDecls = stmtblock->getVariableDecls();
-        for (int j=varDecls->first(); varDecls->more(j); j=varDecls->next(j)) {
-            varDecls->nth(j)->check();
-        }
-
-        // 2. check stmts
+        // check stmtBlock, which declares its own variableDecls
         stmtblock->check(returnType);
         if (!stmtblock->isReturn()) {
             semant_error(this)<<"Function "<<name<<" must have an overall return statement."<<endl;
@@ -331,8 +404,9 @@ void ForStmt_class::check(Symbol type) {
     loop->checkType();
     // For condition should be Bool
     if(condition->is_empty_Expr() == false){
-        if(condition->checkType() != Bool){
-        semant_error(this)<<"Condition must be a Bool, got "<<condition->checkType()<<endl;
+        Symbol conditionType = condition->checkType();
+        if(conditionType != Bool){
+        semant_error(this)<<"Condition must be a Bool, got "<<conditionType<<endl;
         }
     }
 
@@ -380,7 +454,7 @@ Symbol Call_class::checkType(){
             return type;
         }
 
-        for(int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+        for(int i=actuals->next(actuals->first()); actuals->more(i); i=actuals->next(i)) {
             actuals->nth(i)->checkType();
         }
 
@@ -395,17 +469,14 @@ Symbol Call_class::checkType(){
         semant_error(this)<<"Function can't have more than six called parameters"<<endl;
     }
 
-    if (actuals->len() > 0){
-        for (int i=actuals->first(); actuals->more(i) && j<methodTable[name].size(); i=actuals->next(i)) {
-            Expr expr = actuals->nth(i)->copy_Expr();
-            Symbol sym = expr->checkType();
-            // check function call's paras fit funcdecl's paras
-            if (sym != methodTable[name][j]) {
-                semant_error(this)<<"Function "<<name<<", type "<<sym<<" does not conform to declared type "<<methodTable[name][j]<<endl;
-            }
-            j ++;
-            actuals->nth(i)->checkType();
+    // each actual is checked once, its type is then kept in the node
+    for (int i=actuals->first(); actuals->more(i); i=actuals->next(i)) {
+        Symbol sym = actuals->nth(i)->checkType();
+        // check function call's paras fit funcdecl's paras
+        if (j < methodTable[name].size() && sym != methodTable[name][j]) {
+            semant_error(this)<<"Function "<<name<<", type "<<sym<<" does not conform to declared type "<<methodTable[name][j]<<endl;
         }
+        j ++;
     }
     
     if (callTable[name] == NULL) {
@@ -443,258 +514,227 @@ Symbol Assign_class::checkType(){
 }
 
 Symbol Add_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != rs && !(ls == Int && rs == Float) && !(ls == Float && rs == Int)) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"lvalue and rvalue should have same type."<<endl;
+        t = ls;
     }
-    if ((ls == Float && rs == Int)||(ls == Int && rs == Float)) {
-        this->setType(Float);
-        return type;
-    }
-
-    this->setType(ls);
+    this->setType(t);
     return type;
 }
 
 Symbol Minus_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != rs && !(ls == Int && rs == Float) && !(ls == Float && rs == Int)) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
     }
-    if ((ls == Float && rs == Int)||(ls == Int && rs == Float)) {
-        this->setType(Float);
-        return type;
-    }
-
-    this->setType(ls);
+    this->setType(t);
     return type;
 }
 
 Symbol Multi_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != rs && !(ls == Int && rs == Float) && !(ls == Float && rs == Int)) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
     }
-    if ((ls == Float && rs == Int)||(ls == Int && rs == Float)) {
-        this->setType(Float);
-        return type;
-    }
-
-    this->setType(ls);
+    this->setType(t);
     return type;
 }
 
 Symbol Divide_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != rs && !(ls == Int && rs == Float) && !(ls == Float && rs == Int)) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ARITHMETIC_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
     }
-    if ((ls == Float && rs == Int)||(ls == Int && rs == Float)) {
-        this->setType(Float);
-        return type;
-    }
-
-    this->setType(ls);
+    this->setType(t);
     return type;
 }
 
 Symbol Mod_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != rs && !(ls == Int && rs == Float) && !(ls == Float && rs == Int)) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(MODULO_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Int"<<endl;
+        t = ls;
     }
-    if ((ls == Float && rs == Int)||(ls == Int && rs == Float)) {
-        this->setType(Float);
-        return type;
-    }
-
-    this->setType(ls);
+    this->setType(t);
     return type;
 }
 
 Symbol Neg_class::checkType(){
-    Expr value = e1;
-    Symbol sym = e1->checkType();
-    if (sym != Int && sym != Float) {
+    Symbol ls = e1->checkType();
+    Symbol t;
+    if (!operator_type(NEGATION_OPERATOR, e1, e1, t)) {
         semant_error(this)<<"Neg_class should have Int type"<<endl;
+        t = Int;
     }
-    this->setType(Int);
+    this->setType(t);
     return type;
 }
 
 Symbol Lt_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-    if ((ls != Int && ls !=Float) || (rs != Int && rs != Float)) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"ltype mismatch rvalue"<<endl;
+        t = Bool;
     }
-    this->setType(Bool); 
+    this->setType(t);
     return type;
 }
 
 Symbol Le_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-    if ((ls != Int && ls !=Float) || (rs != Int && rs != Float)) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"ltype mismatch rtype"<<endl;
+        t = Bool;
     }
-    this->setType(Bool); 
+    this->setType(t);
     return type;
 }
 
 Symbol Equ_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-    if (((ls != Int && ls !=Float) || (rs != Int && rs != Float))&&(ls != Bool || rs != Bool)) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(EQUALITY_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"ltype mismatch rtype"<<endl;
-    }    
-    this->setType(Bool); 
+        t = Bool;
+    }
+    this->setType(t);
     return type;
 }
 
 Symbol Neq_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-    if (((ls != Int && ls !=Float) || (rs != Int && rs != Float))&&(ls != Bool || rs != Bool)) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(EQUALITY_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"ltype mismatch rtype"<<endl;
-    }    
-    this->setType(Bool); 
+        t = Bool;
+    }
+    this->setType(t);
     return type;
 }
 
 Symbol Ge_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-    if ((ls != Int && ls !=Float) || (rs != Int && rs != Float)) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"ltype mismatch rtype"<<endl;
-    }    
-    this->setType(Bool); 
+        t = Bool;
+    }
+    this->setType(t);
     return type;
 }
 
 Symbol Gt_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-    if ((ls != Int && ls !=Float) || (rs != Int && rs != Float)) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(ORDER_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"ltype mismatch rtype"<<endl;
-    }    
-    this->setType(Bool); 
+        t = Bool;
+    }
+    this->setType(t);
     return type;
 }
 
 Symbol And_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != Bool || rs != Bool) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(LOGICAL_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Bool"<<endl;
+        t = Bool;
     }
-    this->setType(Bool);
+    this->setType(t);
     return type;
 }
 
 Symbol Or_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (ls != Bool || rs != Bool) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(LOGICAL_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Bool"<<endl;
+        t = Bool;
     }
-    this->setType(Bool);
+    this->setType(t);
     return type;
 }
 
 Symbol Xor_class::checkType(){
-    Expr lvalue = e1;
-    Expr rvalue = e2;
-    Symbol ls = lvalue->checkType();
-    Symbol rs = rvalue->checkType();
-
-    if (!(ls == Bool && rs == Bool) && !(ls == Int && rs ==Int)) {
+    Symbol ls = e1->checkType();
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(XOR_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Both lvalue and rvalue should be type Bool"<<endl;
+        t = Bool;
     }
-    this->setType(Bool);
+    this->setType(t);
     return type;
 }
 
 Symbol Not_class::checkType(){
-    Symbol sym = e1->checkType();
-    if (sym != Bool) {
+    Symbol ls = e1->checkType();
+    Symbol t;
+    if (!operator_type(NOT_OPERATOR, e1, e1, t)) {
         semant_error(this)<<"Not class should have Bool type"<<endl;
+        t = ls;
     }
-
-    this->setType(sym);
+    this->setType(t);
     return type;
 }
 
 Symbol Bitand_class::checkType(){
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-
-    if (ls != Int || rs != Int) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(BITWISE_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Bitand class should have Int type"<<endl;
+        t = Int;
     }
-
-    this->setType(Int);
+    this->setType(t);
     return type;
 }
 
 Symbol Bitor_class::checkType(){
     Symbol ls = e1->checkType();
-    Symbol rs = e2->checkType();
-
-    if (ls != Int || rs != Int) {
+    e2->checkType();
+    Symbol t;
+    if (!operator_type(BITWISE_OPERATOR, e1, e2, t)) {
         semant_error(this)<<"Bitor class should have Int type"<<endl;
+        t = Int;
     }
-
-    this->setType(Int);
+    this->setType(t);
     return type;
 }
 
 Symbol Bitnot_class::checkType(){
-    Symbol sym = e1->checkType();
-
-    if (sym != Int) {
+    Symbol ls = e1->checkType();
+    Symbol t;
+    if (!operator_type(BITNOT_OPERATOR, e1, e1, t)) {
         semant_error(this)<<"Bitnot class should have Int type"<<endl;
+        t = Int;
     }
-
-    this->setType(Int);
+    this->setType(t);
     return type;
 }
 
@@ -739,7 +779,18 @@ Symbol No_expr_class::checkType(){
     return getType();
 }
 
+// give the tables back when the compilation ends, see Arena
+static void free_tables() {
+    objectEnv.clear();
+    callTable.clear();
+    globalVars.clear();
+    localVars.clear();
+    methodTable.clear();
+    installTable.clear();
+}
+
 void Program_class::semant() {
+    tree_arena.at_release(free_tables);
     initialize_constants();
     install_calls(decls);
     check_main();
@@ -14,6 +14,9 @@
 #ifndef _SYMTAB_H_
 #define _SYMTAB_H_
 
+#include <deque>
+#include <vector>
+#include <unordered_map>
 #include "list.h"
 
 //
@@ -35,54 +38,49 @@ public:
 //
 // SymbolTable<SYM,DAT> describes a symbol table mapping symbols of
 //    type `SYM' to data of type `DAT *'.  It is implemented as a
-//    list of lists of `SymtabEntry<SYM,DAT> *'.  The inner list is
-//    a scope, a mapping from symbols to data, and the outer list is
-//    a list of scopes. 
+//    hash map from each symbol to the stack of entries that bind it,
+//    innermost last, plus an undo log holding every entry in the
+//    order it was added.  `marks' records where each scope starts
+//    in the log.
 //
-//    `tbl' points to the current top scope.
+//    `enterscope' pushes the current length of the log as the start
+//       of a new scope.
 //
-//    `enterscope' makes the table point to a new scope whose parent
-//       is the scope it pointed to previously.
-//
-//    `exitscope' makes the table point to the parent scope of the
-//        current scope.  Note that the old child scope is not
-//        deallocated.  One may save the state of a symbol table
-//        at a given point by copying it with `operator ='
+//    `exitscope' pops every entry added since the matching
+//        `enterscope' off the log and off its symbol's stack, and
+//        frees them; a symbol left with no entries is dropped from
+//        the map.  Entries returned by `addid' are only valid until
+//        their scope is exited.  Copying a table copies every entry.
 //
 //    `addid(s,i)' adds a symbol table entry to the current scope of
-//        the symbol table mapping symbol `s' to data `d'.  The old
-//        top scope isn't modified; a new scope is created whose
-//        entry list is the new entry followed by the old entry list,
-//        and whose tail is the old top scope's parent.  The table
-//        is made to point to this new scope.
+//        the symbol table mapping symbol `s' to data `d', shadowing
+//        any earlier entry for `s'.
+//
+//    `lookup(s)' returns the data item of the innermost entry for
+//        the symbol `s', or NULL if no such entry exists.
 //
-//    `lookup(s)' looks for the symbol `s', starting at the top scope
-//        and proceeding down the list of scopes until either an
-//        entry is found whose `get_id()' equals `s', or the end of
-//        the root scope is reached.  It returns the data item
-//        associated with the entry, or NULL if no such entry exists.
+//    `probe(s)' returns the data item of the innermost entry for
+//        `s' if that entry belongs to the top scope, and NULL
+//        otherwise.
 //
-//    
-//    `probe(s)' checks the top scope for an entry whose `get_id()'
-//        equals `s', and returns the entry's `get_info()' if
-//        found, and NULL otherwise.
+//    `clear()' drops every scope and gives back the storage the
+//        table holds.
 //
-//    `dump()' prints the symbols in the symbol table.
+//    `dump()' prints the symbols in the symbol table, innermost
+//        scope first and the newest entry of each scope first.
 //
 
 template <class SYM, class DAT>
 class SymbolTable
 {
    typedef SymtabEntry<SYM,DAT> ScopeEntry;
-   typedef List<ScopeEntry> Scope;
-   typedef List<Scope> ScopeList;
+   typedef std::vector<size_t> Shadows;
 private:
-   ScopeList  *tbl;
+   std::deque<ScopeEntry> log;                     // every live entry, oldest first
+   std::vector<size_t> marks;                      // index in `log' where each scope starts
+   std::unordered_map<SYM, Shadows> bindings;      // symbol -> its entries in `log'
 public:
-   SymbolTable(): tbl(NULL) { }     // create a new symbol table
-
-   // Create pointer to current symbol table.
-   SymbolTable &operator =(const SymbolTable &s) { tbl = s.tbl; return *this; }
+   SymbolTable() { }     // create a new symbol table
 
    void fatal_error(char * msg)
    {
@@ -90,36 +88,41 @@ public:
      exit(1);
    } 
 
-   // Enter a new scope.  A symbol table is organized as a list of
-   // lists.  The head of the list is the innermost scope, the tail
-   // holds the outer scopes.  A scope must be entered before anything
+   // Enter a new scope.  A scope must be entered before anything
    // can be added to the table.
 
    void enterscope()
    {
-       // The cast of NULL is required for template instantiation to work
-       // correctly.
-       tbl = new ScopeList((Scope *) NULL, tbl);
+       marks.push_back(log.size());
    }
 
-   // Pop the first scope off of the symbol table.
+   // Pop the innermost scope off of the symbol table, undoing every
+   // addid made in it.
    void exitscope()
    {
        // It is an error to exit a scope that doesn't exist.
-       if (tbl == NULL) {
+       if (marks.empty()) {
 	   fatal_error("exitscope: Can't remove scope from an empty symbol table.");
        }
-       tbl = tbl->tl();
+       while (log.size() > marks.back()) {
+	   typename std::unordered_map<SYM, Shadows>::iterator i = bindings.find(log.back().get_id());
+	   i->second.pop_back();
+	   if (i->second.empty()) {
+	       bindings.erase(i);
+	   }
+	   log.pop_back();
+       }
+       marks.pop_back();
    }
 
    // Add an item to the symbol table.
    ScopeEntry *addid(SYM s, DAT *i)
    {
        // There must be at least one scope to add a symbol.
-       if (tbl == NULL) fatal_error("addid: Can't add a symbol without a scope.");
-       ScopeEntry * se = new ScopeEntry(s,i);
-       tbl = new ScopeList(new Scope(se, tbl->hd()), tbl->tl());
-       return(se);
+       if (marks.empty()) fatal_error("addid: Can't add a symbol without a scope.");
+       bindings[s].push_back(log.size());
+       log.push_back(ScopeEntry(s,i));
+       return(&log.back());
    }
    
    // Lookup an item through all scopes of the symbol table.  If found
@@ -128,43 +131,49 @@ public:
 
    DAT * lookup(SYM s)
    {
-       for(ScopeList *i = tbl; i != NULL; i=i->tl()) {
-	   for( Scope *j = i->hd(); j != NULL; j = j->tl()) {
-	       if (s == j->hd()->get_id()) {
-		   return (j->hd()->get_info());
-	       }
-	   }
+       typename std::unordered_map<SYM, Shadows>::const_iterator i = bindings.find(s);
+       if (i == bindings.end() || i->second.empty()) {
+	   return NULL;
        }
-       return NULL;
+       return log[i->second.back()].get_info();
    }
 
    // probe the symbol table.  Check the top scope (only) for the item
    // 's'.  If found, return the information field.  If not return NULL.
    DAT *probe(SYM s)
    {
-       if (tbl == NULL) {
+       if (marks.empty()) {
 	   fatal_error("probe: No scope in symbol table.");
        }
-       for(Scope *i = tbl->hd(); i != NULL; i = i->tl()) {
-	   if (s == i->hd()->get_id()) {
-	       return(i->hd()->get_info());
-	   }
+       typename std::unordered_map<SYM, Shadows>::const_iterator i = bindings.find(s);
+       if (i == bindings.end() || i->second.empty() || i->second.back() < marks.back()) {
+	   return(NULL);
        }
-       return(NULL);
+       return(log[i->second.back()].get_info());
+   }
+
+   // Drop every scope; swapping with empty containers frees the
+   // storage that clear() on them would keep.
+   void clear()
+   {
+       std::deque<ScopeEntry>().swap(log);
+       std::vector<size_t>().swap(marks);
+       std::unordered_map<SYM, Shadows>().swap(bindings);
    }
 
    // Prints out the contents of the symbol table  
    void dump()
    {
-      for(ScopeList *i = tbl; i != NULL; i = i->tl()) {
+      size_t end = log.size();
+      for(size_t scope = marks.size(); scope-- > 0; ) {
          cerr << "\nScope: \n";
-         for(Scope *j = i->hd(); j != NULL; j = j->tl()) {
-            cerr << "  " << j->hd()->get_id() << endl;
+         for(size_t j = end; j-- > marks[scope]; ) {
+            cerr << "  " << log[j].get_id() << endl;
          }
+         end = marks[scope];
       }
    }
  
 };
 
 #endif
-
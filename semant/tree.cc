@@ -18,6 +18,49 @@
 /* line number to assign to the current node being constructed */
 int node_lineno = 1;
 
+Arena tree_arena;
+
+///////////////////////////////////////////////////////////////////////////
+//
+// Arena::grow
+//
+// start a new block for an allocation that does not fit in the current
+// one; objects bigger than a quarter block get a block of their own
+//
+///////////////////////////////////////////////////////////////////////////
+void *Arena::grow(size_t size)
+{
+    if (size > ARENA_BLOCK / 4) {
+	char *big = new char[size];
+	blocks.push_back(big);
+	return big;
+    }
+    next = new char[ARENA_BLOCK];
+    end = next + ARENA_BLOCK;
+    blocks.push_back(next);
+    void *p = next;
+    next += size;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////
+//
+// Arena::release
+//
+///////////////////////////////////////////////////////////////////////////
+void Arena::release()
+{
+    while (!owners.empty()) {
+	void (*clear)() = owners.back();
+	owners.pop_back();
+	clear();
+    }
+    for (size_t i = 0; i < blocks.size(); i++)
+	delete [] blocks[i];
+    blocks.clear();
+    next = end = NULL;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 //
 // tree_node::tree_node
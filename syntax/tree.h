@@ -17,6 +17,84 @@
 
 #include "stringtab.h"
 #include "seal-io.h"
+#include <new>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////
+//
+//  Arena
+//
+//   Everything built during a compilation and kept until its end
+//   (tree nodes, the element vectors of lists, what semant stores in
+//   its symbol tables) is allocated from tree_arena: memory is taken
+//   from large blocks by bumping a pointer and is never freed one
+//   object at a time.
+//
+//       void *allocate(size_t size)
+//       T *create<T>(args)
+//         a T constructed from args in the arena
+//
+//       void at_release(void (*clear)())
+//         has release() call clear first.  Whatever keeps heap storage
+//         for the whole compilation outside the arena (semant's tables,
+//         the string tables) registers a function giving it back.
+//
+//       void release()
+//         calls the registered functions, newest first, then frees
+//         every block at once.  This ends the compilation: nothing
+//         allocated from the arena may be used afterwards.  No
+//         destructors are run for what is in the arena, so it must not
+//         own storage elsewhere; tree nodes and lists own none.
+//
+//   ArenaAllocator<T> lets a standard container keep its storage in
+//   tree_arena.  Storage given back by the container is not reused.
+//
+/////////////////////////////////////////////////////////////////////
+
+#define ARENA_BLOCK (1 << 16)
+#define ARENA_ALIGN 16
+
+class Arena {
+private:
+    std::vector<char *> blocks;
+    std::vector<void (*)()> owners;
+    char *next, *end;
+    void *grow(size_t size);
+public:
+    Arena() : next(NULL), end(NULL) { }
+    void *allocate(size_t size)
+    {
+	size = (size + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1);
+	if ((size_t) (end - next) < size)
+	    return grow(size);
+	void *p = next;
+	next += size;
+	return p;
+    }
+    template <class T, class... Args> T *create(Args&&... args)
+    {
+	return new (allocate(sizeof(T))) T(std::forward<Args>(args)...);
+    }
+    void at_release(void (*clear)()) { owners.push_back(clear); }
+    void release();
+};
+
+extern Arena tree_arena;
+
+template <class T> class ArenaAllocator {
+public:
+    typedef T value_type;
+    ArenaAllocator() { }
+    template <class U> ArenaAllocator(const ArenaAllocator<U> &) { }
+    T *allocate(size_t n) { return (T *) tree_arena.allocate(n * sizeof(T)); }
+    void deallocate(T *, size_t) { }
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T> &, const ArenaAllocator<U> &) { return true; }
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T> &, const ArenaAllocator<U> &) { return false; }
 
 /////////////////////////////////////////////////////////////////////
 //
@@ -30,6 +108,8 @@
 //      
 //
 //
+//   Tree nodes are allocated from tree_arena, see Arena.
+//
 //   The public methods are:
 //       tree_node()
 //         builds a new tree_node.  The type field is NULL, the
@@ -54,6 +134,8 @@ protected:
     int line_number;            // stash the line number when node is made
 public:
     tree_node();
+    static void *operator new(size_t size) { return tree_arena.allocate(size); }
+    static void operator delete(void *) { }
     virtual tree_node *copy() = 0;
     virtual ~tree_node() { }
     virtual void dump(ostream& stream, int n) = 0;
@@ -89,14 +171,21 @@ public:
 //     for(int i = l->first(); l->more(i); i = l->next(i))
 //         ... operate on l->nth(i) ...
 //
+//     iterator begin();
+//     iterator end();
+//       The same in the form of a standard iterator range, as in
+//
+//     for (Elem e : *l) ...
+//
+//     Appending to a list may move its elements, so the iterators of a
+//     list must not be kept across an append to it.
 //      
 //     int len()
 //     returns the length of the list
 //
 //     nth_length(int n, int &len);
 //     Returns the nth element of the list or NULL if there are not n elements.
-//     "len" is set to the length of the list.  This method is used internally
-//     by the APS package to efficiently traverse the list representation.  
+//     "len" is set to the length of the list.
 //
 //     static list_node<Elem> *nil();
 //     static list_node<Elem> *single(Elem);
@@ -110,9 +199,24 @@ public:
 //     list_node<Elem>::single(e);     where "e" has type Elem
 //     list_node<Elem>::append(l1,l2);
 //
+//  The elements are kept in a vector, so len() and nth() take constant
+//  time.  A list is the first len() elements of a vector that may be
+//  shared with lists appended to it: when l1 is the longest list of its
+//  vector, append(l1,l2) adds the elements of l2 to that vector rather
+//  than copying l1, which makes building a list one append at a time
+//  (as the parser does) linear.  l1 itself is left unchanged.  The
+//  vectors, like the lists, live in tree_arena.
+//
 //////////////////////////////////////////////////////////////////////////////
 
 template <class Elem> class list_node : public tree_node {
+protected:
+    typedef std::vector<Elem, ArenaAllocator<Elem> > Elems;
+    Elems *elems;               // shared with the lists appended to this one
+    int length;                 // this list is the first length elements
+
+    list_node() : elems(tree_arena.create<Elems>()), length(0) { }
+    list_node(list_node<Elem> *l1, list_node<Elem> *l2);
 public:
     tree_node *copy()            { return copy_list(); }
     Elem nth(int n);
@@ -121,12 +225,17 @@ public:
     //
     int first()      { return 0; }
     int next(int n)  { return n + 1; }
-    int more(int n)  { return (n < len()); }
+    int more(int n)  { return (n < length); }
+
+    typedef typename Elems::const_iterator iterator;
+    iterator begin() const { return elems->begin(); }
+    iterator end() const   { return elems->begin() + length; }
 
-    virtual list_node<Elem> *copy_list() = 0;
+    list_node<Elem> *copy_list();
     virtual ~list_node() { }
-    virtual int len() = 0;
-    virtual Elem nth_length(int n, int &len) = 0;
+    int len()        { return length; }
+    Elem nth_length(int n, int &len);
+    void dump(ostream& stream, int n);
 
     static list_node<Elem> *nil();
     static list_node<Elem> *single(Elem);
@@ -137,40 +246,25 @@ char *pad(int n);
 
 extern int info_size;
 
+//
+// The three ways to make a list, under the names the APS package uses.
+//
 template <class Elem> class nil_node : public list_node<Elem> {
 public:
-    list_node<Elem> *copy_list();
-    int len();
-    Elem nth_length(int n, int &len);
-    void dump(ostream& stream, int n);
+    nil_node() { }
 };
 
 template <class Elem> class single_list_node : public list_node<Elem> {
-    Elem elem;
 public:
     single_list_node(Elem t) {
-	elem = t;
+	this->elems->push_back(t);
+	this->length = 1;
     }
-    list_node<Elem> *copy_list();
-    int len();
-    Elem nth_length(int n, int &len);
-    void dump(ostream& stream, int n);
 };
 
-
 template <class Elem> class append_node : public list_node<Elem> {
-private:
-    list_node<Elem> *some, *rest;
 public:
-    append_node(list_node<Elem> *l1, list_node<Elem> *l2) {
-	some = l1;
-	rest = l2;
-    }
-    list_node<Elem> *copy_list();
-    int len();
-    Elem nth(int n);
-    Elem nth_length(int n, int &len);
-    void dump(ostream& stream, int n);
+    append_node(list_node<Elem> *l1, list_node<Elem> *l2) : list_node<Elem>(l1, l2) { }
 };
 
 
@@ -188,210 +282,100 @@ template <class Elem> list_node<Elem> *list_node<Elem>::append(list_node<Elem> *
 
 ///////////////////////////////////////////////////////////////////////////
 //
-// list_node::nth
+// list_node::list_node
 //
-// function to find the nth element of the list
+// the list of the elements of l1 followed by those of l2
 //
 ///////////////////////////////////////////////////////////////////////////
 
-template <class Elem> Elem list_node<Elem>::nth(int n)
-{
-    int len;
-    Elem tmp = nth_length(n ,len);
-
-    if (tmp)
-	return tmp;
-    else {
-	cerr << "error: outside the range of the list\n";
-	exit(1);
-    }
-}
-
-// added 10/30/06 cgs
-template <class Elem> Elem append_node<Elem>::nth(int n)
+template <class Elem> list_node<Elem>::list_node(list_node<Elem> *l1, list_node<Elem> *l2)
 {
-    int len;
-    Elem tmp = nth_length(n ,len);
-
-    if (tmp)
-	return tmp;
-    else {
-	cerr << "error: outside the range of the list\n";
-	exit(1);
-    }
-}
+    std::vector<Elem> rest(l2->begin(), l2->end());
 
-///////////////////////////////////////////////////////////////////////////
-//
-// nil_node::copy_list
-//
-// return the deep copy of the nil_node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> list_node<Elem> *nil_node<Elem>::copy_list()
-{
-    return new nil_node<Elem>();
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-//
-// nil_node::len
-//
-// return the length of the nil_node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> int nil_node<Elem>::len()
-{
-    return 0;
-}
-
-
-
-///////////////////////////////////////////////////////////////////////////
-//
-// nil_node::nth_length
-//
-// return the nth element on the list
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> Elem nil_node<Elem>::nth_length(int, int &len)
-{
-    len = 0;
-    return NULL;
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-//
-// nil_node::dump
-//
-// dump for list node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> void nil_node<Elem>::dump(ostream& stream, int n)
-{
-    stream << pad(n) << "(nil)\n";
+    if ((int) l1->elems->size() == l1->length)
+	elems = l1->elems;
+    else
+	elems = tree_arena.create<Elems>(l1->begin(), l1->end());
+    elems->insert(elems->end(), rest.begin(), rest.end());
+    length = elems->size();
 }
 
 
 ///////////////////////////////////////////////////////////////////////////
 //
-// single_list_node::copy_list
+// list_node::nth
 //
-// return the deep copy of the single_list_node
+// function to find the nth element of the list
 //
 ///////////////////////////////////////////////////////////////////////////
-template <class Elem> list_node<Elem> *single_list_node<Elem>::copy_list()
-{
-    return new single_list_node<Elem>((Elem) elem->copy());
-}
 
-
-///////////////////////////////////////////////////////////////////////////
-//
-// single_list_node::len
-//
-// return the length of the single_list_node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> int single_list_node<Elem>::len()
+template <class Elem> Elem list_node<Elem>::nth(int n)
 {
-    return 1;
+    if (n >= 0 && n < length)
+	return (*elems)[n];
+    else {
+	cerr << "error: outside the range of the list\n";
+	exit(1);
+    }
 }
 
 
 ///////////////////////////////////////////////////////////////////////////
 //
-// single_list_node::nth_length
+// list_node::nth_length
 //
 // return the nth element on the list
 //
 ///////////////////////////////////////////////////////////////////////////
-template <class Elem> Elem single_list_node<Elem>::nth_length(int n, int &len)
+template <class Elem> Elem list_node<Elem>::nth_length(int n, int &len)
 {
-    len = 1;
-    if (n)
-	return NULL;
+    len = length;
+    if (n >= 0 && n < length)
+	return (*elems)[n];
     else
-	return elem;
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-//
-// single_list_node::dump
-//
-// dump for list node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> void single_list_node<Elem>::dump(ostream& stream, int n)
-{
-    elem->dump(stream, n);
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-//
-// append_node::copy_list
-//
-// return the deep copy of the append_node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> list_node<Elem> *append_node<Elem>::copy_list()
-{
-    return new append_node<Elem>(some->copy_list(), rest->copy_list());
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-//
-// append_node::len
-//
-// return the length of the append_node
-//
-///////////////////////////////////////////////////////////////////////////
-template <class Elem> int append_node<Elem>::len()
-{
-    return some->len() + rest->len();
+	return NULL;
 }
 
 
 ///////////////////////////////////////////////////////////////////////////
 //
-// append_node::nth_length
+// list_node::copy_list
 //
-// return the nth element on the list
+// return the deep copy of the list
 //
 ///////////////////////////////////////////////////////////////////////////
-template <class Elem> Elem append_node<Elem>::nth_length(int n, int &len)
+template <class Elem> list_node<Elem> *list_node<Elem>::copy_list()
 {
-    int rlen;
-    Elem tmp = some->nth_length(n, len);
+    list_node<Elem> *result = new nil_node<Elem>();
 
-    if (!tmp) {
-	tmp = rest->nth_length(n-len, rlen);
-	len += rlen;
-    }
-    return tmp;
+    result->elems->reserve(length);
+    for (int i = 0; i < length; i++)
+	result->elems->push_back((Elem) (*elems)[i]->copy());
+    result->length = length;
+    return result;
 }
 
 
 ///////////////////////////////////////////////////////////////////////////
 //
-// append_node::dump
+// list_node::dump
 //
 // dump for list node
 //
 ///////////////////////////////////////////////////////////////////////////
-template <class Elem> void append_node<Elem>::dump(ostream& stream, int n)
+template <class Elem> void list_node<Elem>::dump(ostream& stream, int n)
 {
-    int i, size;
-
-    size = len();
+    if (length == 0) {
+	stream << pad(n) << "(nil)\n";
+	return;
+    }
+    if (length == 1) {
+	(*elems)[0]->dump(stream, n);
+	return;
+    }
     stream << pad(n) << "list\n";
-    for (i = 0; i < size; i++)
-      nth(i)->dump(stream, n+2);
+    for (int i = 0; i < length; i++)
+      (*elems)[i]->dump(stream, n+2);
     stream << pad(n) << "(end_of_list)\n";
 }
 